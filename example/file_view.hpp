@@ -0,0 +1,86 @@
+#ifndef BOOST_ENDIAN_EXAMPLE_FILE_VIEW_HPP_INCLUDED
+#define BOOST_ENDIAN_EXAMPLE_FILE_VIEW_HPP_INCLUDED
+
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// A read-only view of a whole file: memory mapped where possible, read into
+// a buffer otherwise. mapped() tells which.
+
+#include <fstream>
+#include <iterator>
+#include <vector>
+#include <cstddef>
+
+#if defined(__unix__) || defined(__APPLE__)
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <fcntl.h>
+# include <unistd.h>
+# define BOOST_ENDIAN_EXAMPLE_FILE_VIEW_MMAP
+#endif
+
+class file_view
+{
+public:
+
+    explicit file_view( char const * path ): data_( 0 ), size_( 0 ), mapped_( false )
+    {
+#ifdef BOOST_ENDIAN_EXAMPLE_FILE_VIEW_MMAP
+
+        int fd = ::open( path, O_RDONLY );
+        if( fd < 0 ) return;
+
+        struct stat st;
+
+        if( ::fstat( fd, &st ) == 0 && st.st_size > 0 )
+        {
+            void * p = ::mmap( 0, static_cast<std::size_t>( st.st_size ), PROT_READ, MAP_PRIVATE, fd, 0 );
+
+            if( p != MAP_FAILED )
+            {
+                ::madvise( p, static_cast<std::size_t>( st.st_size ), MADV_SEQUENTIAL );
+
+                data_ = static_cast<unsigned char const *>( p );
+                size_ = static_cast<std::size_t>( st.st_size );
+                mapped_ = true;
+            }
+        }
+
+        ::close( fd );
+
+        if( mapped_ ) return;
+
+#endif
+
+        std::ifstream is( path, std::ios::binary );
+        buffer_.assign( std::istreambuf_iterator<char>( is ), std::istreambuf_iterator<char>() );
+
+        data_ = reinterpret_cast<unsigned char const *>( buffer_.data() );
+        size_ = buffer_.size();
+    }
+
+    file_view( file_view const & ) = delete;
+    file_view & operator=( file_view const & ) = delete;
+
+    ~file_view()
+    {
+#ifdef BOOST_ENDIAN_EXAMPLE_FILE_VIEW_MMAP
+        if( mapped_ ) ::munmap( const_cast<unsigned char *>( data_ ), size_ );
+#endif
+    }
+
+    unsigned char const * data() const { return data_; }
+    std::size_t size() const { return size_; }
+    bool mapped() const { return mapped_; }
+
+private:
+
+    unsigned char const * data_;
+    std::size_t size_;
+    bool mapped_;
+    std::vector<char> buffer_;
+};
+
+#endif  // BOOST_ENDIAN_EXAMPLE_FILE_VIEW_HPP_INCLUDED
@@ -0,0 +1,232 @@
+//  fits_reader.cpp  ---------------------------------------------------------//
+
+//  Copyright 2026 Julien Blanc
+
+//  Distributed under the Boost Software License, Version 1.0.
+//  See http://www.boost.org/LICENSE_1_0.txt
+
+//  Reads the primary array of a FITS file into physical values,
+//
+//    physical = BZERO + BSCALE * array
+//
+//  The file is memory mapped where possible and the big endian array is split into tiles
+//  that a pool of threads converts with endian_affine, which swaps, converts
+//  to float and scales each tile in a single pass.
+//
+//  Usage: fits_reader image.fits [threads]
+
+//----------------------------------------------------------------------------//
+
+#include "file_view.hpp"
+#include <boost/endian/affine.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace boost::endian;
+
+namespace
+{
+  std::size_t const block_size = 2880;
+  std::size_t const card_size = 80;
+
+  // elements converted by a thread at a time
+  std::size_t const tile_size = 1 << 20;
+
+  struct fits_header
+  {
+    int bitpix = 0;
+    std::vector<std::size_t> axes;
+    double bscale = 1;
+    double bzero = 0;
+    bool has_blank = false;
+    std::int64_t blank = 0;
+
+    // offset of the data from the start of the file
+    std::size_t data_offset = 0;
+
+    std::size_t elements() const
+    {
+      std::size_t n = axes.empty()? 0: 1;
+      for( std::size_t i = 0; i < axes.size(); ++i ) n *= axes[ i ];
+      return n;
+    }
+  };
+
+  // Returns: false if the header is malformed or has no END card
+
+  bool parse_header( unsigned char const * p, std::size_t size, fits_header & h )
+  {
+    for( std::size_t offset = 0; offset + card_size <= size; offset += card_size )
+    {
+      std::string card( reinterpret_cast<char const*>( p + offset ), card_size );
+      std::string key = card.substr( 0, 8 );
+
+      key.erase( key.find_last_not_of( ' ' ) + 1 );
+
+      if( key == "END" )
+      {
+        h.data_offset = ( offset / block_size + 1 ) * block_size;
+        return h.bitpix != 0 && h.data_offset + h.elements() * ( std::abs( h.bitpix ) / 8 ) <= size;
+      }
+
+      if( card.compare( 8, 2, "= " ) != 0 ) continue;
+
+      char const * value = card.c_str() + 10;
+
+      if( key == "BITPIX" )
+      {
+        h.bitpix = std::atoi( value );
+      }
+      else if( key == "NAXIS" )
+      {
+        h.axes.resize( std::strtoul( value, 0, 10 ) );
+      }
+      else if( key.compare( 0, 5, "NAXIS" ) == 0 )
+      {
+        std::size_t i = std::strtoul( key.c_str() + 5, 0, 10 );
+        if( i >= 1 && i <= h.axes.size() ) h.axes[ i - 1 ] = std::strtoul( value, 0, 10 );
+      }
+      else if( key == "BSCALE" )
+      {
+        h.bscale = std::strtod( value, 0 );
+      }
+      else if( key == "BZERO" )
+      {
+        h.bzero = std::strtod( value, 0 );
+      }
+      else if( key == "BLANK" )
+      {
+        h.has_blank = true;
+        h.blank = std::strtoll( value, 0, 10 );
+      }
+    }
+
+    return false;
+  }
+
+  // BLANK only applies to integer arrays
+
+  template<class T> void convert_tile( float * dst, unsigned char const * src, std::size_t n, fits_header const & h, std::true_type )
+  {
+    float const scale = static_cast<float>( h.bscale );
+    float const offset = static_cast<float>( h.bzero );
+
+    if( h.has_blank )
+    {
+      endian_affine<T, sizeof( T ), order::big>( dst, src, n, scale, offset, static_cast<T>( h.blank ) );
+    }
+    else
+    {
+      endian_affine<T, sizeof( T ), order::big>( dst, src, n, scale, offset );
+    }
+  }
+
+  template<class T> void convert_tile( float * dst, unsigned char const * src, std::size_t n, fits_header const & h, std::false_type )
+  {
+    endian_affine<T, sizeof( T ), order::big>( dst, src, n, static_cast<float>( h.bscale ), static_cast<float>( h.bzero ) );
+  }
+
+  // converts the whole array, each thread taking the next tile until none is left
+
+  template<class T> void convert( float * dst, unsigned char const * src, fits_header const & h, unsigned threads )
+  {
+    std::size_t const n = h.elements();
+    std::size_t const tiles = ( n + tile_size - 1 ) / tile_size;
+
+    std::atomic<std::size_t> next( 0 );
+
+    auto worker = [&]()
+    {
+      for( ;; )
+      {
+        std::size_t const t = next++;
+        if( t >= tiles ) break;
+
+        std::size_t const first = t * tile_size;
+        std::size_t const m = std::min( tile_size, n - first );
+
+        convert_tile<T>( dst + first, src + first * sizeof( T ), m, h, std::is_integral<T>() );
+      }
+    };
+
+    std::vector<std::thread> pool;
+
+    for( unsigned i = 1; i < threads; ++i ) pool.emplace_back( worker );
+
+    worker();
+
+    for( std::size_t i = 0; i < pool.size(); ++i ) pool[ i ].join();
+  }
+}
+
+int main( int argc, char * argv[] )
+{
+  if( argc < 2 )
+  {
+    std::cerr << "Usage: fits_reader image.fits [threads]\n";
+    return 2;
+  }
+
+  unsigned threads = argc > 2? static_cast<unsigned>( std::atoi( argv[2] ) ): std::thread::hardware_concurrency();
+  if( threads == 0 ) threads = 1;
+
+  file_view file( argv[1] );
+
+  if( file.size() == 0 )
+  {
+    std::cerr << "Cannot open " << argv[1] << "\n";
+    return 1;
+  }
+
+  unsigned char const * p = file.data();
+  std::size_t const size = file.size();
+
+  fits_header h;
+
+  if( !parse_header( p, size, h ) )
+  {
+    std::cerr << "Not a FITS file, or truncated\n";
+    return 1;
+  }
+
+  std::vector<float> image( h.elements() );
+
+  unsigned char const * data = p + h.data_offset;
+
+  switch( h.bitpix )
+  {
+  case 8: convert<std::uint8_t>( image.data(), data, h, threads ); break;
+  case 16: convert<std::int16_t>( image.data(), data, h, threads ); break;
+  case 32: convert<std::int32_t>( image.data(), data, h, threads ); break;
+  case 64: convert<std::int64_t>( image.data(), data, h, threads ); break;
+  case -32: convert<float>( image.data(), data, h, threads ); break;
+  case -64: convert<double>( image.data(), data, h, threads ); break;
+
+  default:
+
+    std::cerr << "Unsupported BITPIX " << h.bitpix << "\n";
+    return 1;
+  }
+
+  double sum = 0;
+  std::size_t valid = 0;
+
+  for( std::size_t i = 0; i < image.size(); ++i )
+  {
+    if( image[ i ] == image[ i ] )
+    {
+      sum += image[ i ];
+      ++valid;
+    }
+  }
+
+  std::cout << image.size() << " values (BITPIX " << h.bitpix << "), " << image.size() - valid << " blank, mean " << ( valid? sum / valid: 0 ) << "\n";
+}
@@ -0,0 +1,100 @@
+//  pcap_dump.cpp  -----------------------------------------------------------//
+
+//  Copyright 2026 Julien Blanc
+
+//  Distributed under the Boost Software License, Version 1.0.
+//  See http://www.boost.org/LICENSE_1_0.txt
+
+//  Summarizes a pcap or pcapng capture: the file is memory mapped and its
+//  packets are visited in place by pcap::for_each_packet, and the Ethernet
+//  frames among them are classified with boost::endian::parse_packet.
+//
+//  Usage: pcap_dump capture.pcap
+
+//----------------------------------------------------------------------------//
+
+#include "pcap_reader.hpp"
+#include "file_view.hpp"
+#include <boost/endian/net_headers.hpp>
+#include <iostream>
+#include <functional>
+#include <cstdint>
+#include <cstddef>
+
+namespace
+{
+  struct summary
+  {
+    std::uint64_t packets = 0;
+    std::uint64_t bytes = 0;
+    std::uint64_t truncated = 0;
+    std::uint64_t ipv4 = 0;
+    std::uint64_t ipv6 = 0;
+    std::uint64_t tcp = 0;
+    std::uint64_t udp = 0;
+    std::uint64_t icmp = 0;
+    std::uint64_t malformed = 0;
+
+    void operator()( pcap::packet const & pk )
+    {
+      ++packets;
+      bytes += pk.captured_length;
+
+      if( pk.captured_length < pk.original_length ) ++truncated;
+
+      if( pk.link_type != 1 ) return; // not Ethernet
+
+      boost::endian::parsed_packet r;
+
+      // a packet cut short by the snap length is not malformed
+      if( !boost::endian::parse_packet( r, pk.data, pk.captured_length ) && pk.captured_length == pk.original_length ) ++malformed;
+
+      ipv4 += r.ipv4 != 0;
+      ipv6 += r.ipv6 != 0;
+      tcp += r.tcp != 0;
+      udp += r.udp != 0;
+      icmp += r.icmp != 0;
+    }
+  };
+
+  char const * to_string( pcap::status s )
+  {
+    switch( s )
+    {
+    case pcap::status::ok: return "ok";
+    case pcap::status::unknown_format: return "not a pcap or pcapng file";
+    case pcap::status::truncated: return "truncated";
+    default: return "malformed";
+    }
+  }
+}
+
+int main( int argc, char * argv[] )
+{
+  if( argc != 2 )
+  {
+    std::cerr << "Usage: pcap_dump capture.pcap\n";
+    return 2;
+  }
+
+  file_view file( argv[1] );
+
+  summary s;
+
+  // for_each_packet takes the function object by value
+  pcap::status r = pcap::for_each_packet( file.data(), file.size(), std::ref( s ) );
+
+  std::cout
+    << "status:    " << to_string( r ) << "\n"
+    << "packets:   " << s.packets << "\n"
+    << "bytes:     " << s.bytes << "\n"
+    << "truncated: " << s.truncated << "\n"
+    << "IPv4:      " << s.ipv4 << "\n"
+    << "IPv6:      " << s.ipv6 << "\n"
+    << "TCP:       " << s.tcp << "\n"
+    << "UDP:       " << s.udp << "\n"
+    << "ICMP:      " << s.icmp << "\n"
+    << "malformed: " << s.malformed << "\n";
+
+  return r == pcap::status::ok? 0: 1;
+}
@@ -0,0 +1,270 @@
+#ifndef BOOST_ENDIAN_EXAMPLE_PCAP_READER_HPP_INCLUDED
+#define BOOST_ENDIAN_EXAMPLE_PCAP_READER_HPP_INCLUDED
+
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// A zero-copy reader for pcap and pcapng captures held in memory.
+//
+// Both formats record the byte order of the writer: pcap in the magic number
+// of the file header, pcapng in the byte-order magic of each section header.
+// Rather than passing every field through conditional_reverse( x, file_order,
+// order::native ), the order is detected once per file (or section) and the
+// record loop is instantiated for that order, so that every field is read
+// with an endian_load whose order is a compile-time constant.
+
+#include <boost/endian/conversion.hpp>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace pcap
+{
+
+using boost::endian::order;
+
+// a captured packet; data points into the capture
+
+struct packet
+{
+    // seconds and fraction of a second; see timestamp_units
+    std::uint32_t ts_sec;
+    std::uint32_t ts_frac;
+
+    // the fraction unit, 1000000 or 1000000000 for pcap; for pcapng, the
+    // raw 64-bit timestamp is ts_sec * 2^32 + ts_frac, in interface units
+    std::uint32_t timestamp_units;
+
+    std::uint32_t interface_id;
+    std::uint16_t link_type;
+
+    std::uint32_t original_length;
+    std::uint32_t captured_length;
+
+    unsigned char const * data;
+};
+
+enum class status
+{
+    ok,
+    unknown_format,
+    truncated,
+    malformed
+};
+
+namespace detail
+{
+
+template<order Order> inline std::uint32_t load_u32( unsigned char const * p )
+{
+    return boost::endian::endian_load<std::uint32_t, 4, Order>( p );
+}
+
+template<order Order> inline std::uint16_t load_u16( unsigned char const * p )
+{
+    return boost::endian::endian_load<std::uint16_t, 2, Order>( p );
+}
+
+// pcap: the 24-byte file header is followed by records made of a 16-byte
+// header and the captured bytes
+
+template<order Order, class F> status read_pcap( unsigned char const * p, unsigned char const * end, std::uint32_t units, F & f )
+{
+    packet pk;
+
+    pk.timestamp_units = units;
+    pk.interface_id = 0;
+    pk.link_type = static_cast<std::uint16_t>( load_u32<Order>( p + 20 ) );
+
+    p += 24;
+
+    while( end - p >= 16 )
+    {
+        pk.ts_sec = load_u32<Order>( p );
+        pk.ts_frac = load_u32<Order>( p + 4 );
+        pk.captured_length = load_u32<Order>( p + 8 );
+        pk.original_length = load_u32<Order>( p + 12 );
+
+        p += 16;
+
+        if( pk.captured_length > static_cast<std::size_t>( end - p ) ) return status::truncated;
+
+        pk.data = p;
+        p += pk.captured_length;
+
+        f( pk );
+    }
+
+    return p == end? status::ok: status::truncated;
+}
+
+// pcapng: a section starts with a Section Header Block; its blocks are read
+// until the next section header, whose order may differ
+
+template<order Order, class F> status read_pcapng_section( unsigned char const * & p, unsigned char const * end, std::vector<std::uint16_t> & link_types, F & f )
+{
+    link_types.clear();
+
+    packet pk;
+
+    pk.timestamp_units = 0;
+
+    // the section header itself
+    p += load_u32<Order>( p + 4 );
+
+    while( end - p >= 12 )
+    {
+        std::uint32_t const type = load_u32<Order>( p );
+        std::uint32_t const length = load_u32<Order>( p + 4 );
+
+        if( type == 0x0A0D0D0A ) return status::ok;
+
+        if( length < 12 || length % 4 != 0 ) return status::malformed;
+        if( length > static_cast<std::size_t>( end - p ) ) return status::truncated;
+
+        unsigned char const * body = p + 8;
+        std::uint32_t const body_length = length - 12;
+
+        switch( type )
+        {
+        case 1: // Interface Description Block
+
+            if( body_length < 8 ) return status::malformed;
+
+            link_types.push_back( load_u16<Order>( body ) );
+            break;
+
+        case 3: // Simple Packet Block
+
+            if( body_length < 4 || link_types.empty() ) return status::malformed;
+
+            pk.ts_sec = pk.ts_frac = 0;
+            pk.interface_id = 0;
+            pk.link_type = link_types[ 0 ];
+            pk.original_length = load_u32<Order>( body );
+            pk.captured_length = pk.original_length < body_length - 4? pk.original_length: body_length - 4;
+            pk.data = body + 4;
+
+            f( pk );
+            break;
+
+        case 6: // Enhanced Packet Block
+
+            if( body_length < 20 ) return status::malformed;
+
+            pk.interface_id = load_u32<Order>( body );
+
+            if( pk.interface_id >= link_types.size() ) return status::malformed;
+
+            pk.link_type = link_types[ pk.interface_id ];
+            pk.ts_sec = load_u32<Order>( body + 4 );
+            pk.ts_frac = load_u32<Order>( body + 8 );
+            pk.captured_length = load_u32<Order>( body + 12 );
+            pk.original_length = load_u32<Order>( body + 16 );
+
+            if( pk.captured_length > body_length - 20 ) return status::malformed;
+
+            pk.data = body + 20;
+
+            f( pk );
+            break;
+
+        default: // other blocks are skipped
+
+            break;
+        }
+
+        p += length;
+    }
+
+    return p == end? status::ok: status::truncated;
+}
+
+template<class F> status read_pcapng( unsigned char const * p, unsigned char const * end, F & f )
+{
+    std::vector<std::uint16_t> link_types;
+
+    while( p != end )
+    {
+        if( end - p < 28 ) return status::truncated;
+
+        // the block type is a palindrome, the byte-order magic gives the order
+
+        if( boost::endian::load_little_u32( p ) != 0x0A0D0D0A ) return status::malformed;
+
+        std::uint32_t const magic = boost::endian::load_little_u32( p + 8 );
+
+        order o;
+
+        if( magic == 0x1A2B3C4D )
+        {
+            o = order::little;
+        }
+        else if( magic == 0x4D3C2B1A )
+        {
+            o = order::big;
+        }
+        else
+        {
+            return status::malformed;
+        }
+
+        std::uint32_t const length = boost::endian::conditional_reverse( boost::endian::load_little_u32( p + 4 ), order::little, o );
+
+        if( length < 28 || length % 4 != 0 ) return status::malformed;
+        if( length > static_cast<std::size_t>( end - p ) ) return status::truncated;
+
+        status r = o == order::little? read_pcapng_section<order::little>( p, end, link_types, f ): read_pcapng_section<order::big>( p, end, link_types, f );
+
+        if( r != status::ok ) return r;
+    }
+
+    return status::ok;
+}
+
+} // namespace detail
+
+// Effects: calls f( packet const& ) for each packet of the pcap or pcapng
+// capture in [ p, p + size ), in file order
+
+template<class F> status for_each_packet( unsigned char const * p, std::size_t size, F f )
+{
+    unsigned char const * end = p + size;
+
+    if( size < 4 ) return status::unknown_format;
+
+    // reading the magic as little endian gives its value in a file written
+    // on a little endian machine, and its byte reversal otherwise
+
+    switch( boost::endian::load_little_u32( p ) )
+    {
+    case 0xA1B2C3D4:
+
+        return size < 24? status::truncated: detail::read_pcap<order::little>( p, end, 1000000, f );
+
+    case 0xD4C3B2A1:
+
+        return size < 24? status::truncated: detail::read_pcap<order::big>( p, end, 1000000, f );
+
+    case 0xA1B23C4D:
+
+        return size < 24? status::truncated: detail::read_pcap<order::little>( p, end, 1000000000, f );
+
+    case 0x4D3CB2A1:
+
+        return size < 24? status::truncated: detail::read_pcap<order::big>( p, end, 1000000000, f );
+
+    case 0x0A0D0D0A:
+
+        return detail::read_pcapng( p, end, f );
+
+    default:
+
+        return status::unknown_format;
+    }
+}
+
+} // namespace pcap
+
+#endif  // BOOST_ENDIAN_EXAMPLE_PCAP_READER_HPP_INCLUDED
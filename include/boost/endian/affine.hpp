@@ -0,0 +1,88 @@
+#ifndef BOOST_ENDIAN_AFFINE_HPP_INCLUDED
+#define BOOST_ENDIAN_AFFINE_HPP_INCLUDED
+
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Conversion of arrays of N-byte values stored in a given byte order to
+// float or double, with an affine transform applied in the same pass:
+//
+//    dst[ i ] = value[ i ] * scale + offset
+//
+// as FITS images require with BSCALE and BZERO. Each element is loaded,
+// converted and scaled in registers, in a loop the compiler can vectorize,
+// instead of a byte reversal pass followed by a scaling pass.
+
+#include <boost/endian/detail/endian_load.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/endian/buffers.hpp>
+#include <boost/config.hpp>
+#include <type_traits>
+#include <limits>
+#include <cstddef>
+
+namespace boost
+{
+namespace endian
+{
+
+// Requires:
+//
+//    T, N, Order as for endian_load
+//    D is float or double
+//    src points to n consecutive N-byte values
+//    dst points to storage for n values
+
+template<class T, std::size_t N, order Order, class D>
+inline void endian_affine( D * dst, unsigned char const * src, std::size_t n, D scale, D offset ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( std::is_floating_point<D>::value );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        dst[ i ] = static_cast<D>( boost::endian::endian_load<T, N, Order>( src + i * N ) ) * scale + offset;
+    }
+}
+
+// As above, except that integer values equal to blank, the FITS BLANK
+// keyword, are converted to a quiet NaN
+
+template<class T, std::size_t N, order Order, class D>
+inline void endian_affine( D * dst, unsigned char const * src, std::size_t n, D scale, D offset, T blank ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( std::is_floating_point<D>::value );
+    BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value );
+
+    D const nan = std::numeric_limits<D>::quiet_NaN();
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        T const v = boost::endian::endian_load<T, N, Order>( src + i * N );
+        D const d = static_cast<D>( v ) * scale + offset;
+
+        dst[ i ] = v == blank? nan: d;
+    }
+}
+
+// overloads for arrays of endian_buffer
+
+template<order Order, class T, std::size_t n_bits, align A, class D>
+inline void endian_affine( D * dst, endian_buffer<Order, T, n_bits, A> const * src, std::size_t n, D scale, D offset ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof( endian_buffer<Order, T, n_bits, A> ) == n_bits / 8 );
+    boost::endian::endian_affine<T, n_bits / 8, Order>( dst, reinterpret_cast<unsigned char const*>( src ), n, scale, offset );
+}
+
+template<order Order, class T, std::size_t n_bits, align A, class D>
+inline void endian_affine( D * dst, endian_buffer<Order, T, n_bits, A> const * src, std::size_t n, D scale, D offset, T blank ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof( endian_buffer<Order, T, n_bits, A> ) == n_bits / 8 );
+    boost::endian::endian_affine<T, n_bits / 8, Order>( dst, reinterpret_cast<unsigned char const*>( src ), n, scale, offset, blank );
+}
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_AFFINE_HPP_INCLUDED
@@ -0,0 +1,101 @@
+#ifndef BOOST_ENDIAN_BITFIELD_HPP_INCLUDED
+#define BOOST_ENDIAN_BITFIELD_HPP_INCLUDED
+
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// endian_bitfield<Order, Word, Offset, Width> accesses the field of Width
+// bits at bit Offset (counting from the least significant bit) of a Word
+// stored in the given byte order, such as the version and IHL nibbles or the
+// 13-bit fragment offset of an IPv4 header:
+//
+//    typedef endian_bitfield<order::big, std::uint8_t, 4, 4> ipv4_version;
+//    typedef endian_bitfield<order::big, std::uint16_t, 0, 13> ipv4_fragment_offset;
+//
+// Only the bytes that contain the field are loaded and stored, so a field
+// that lies within a single byte is accessed without any byte swapping.
+
+#include <boost/endian/detail/endian_load.hpp>
+#include <boost/endian/detail/endian_store.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/config.hpp>
+#include <type_traits>
+#include <cstddef>
+
+namespace boost
+{
+namespace endian
+{
+
+template<order Order, class Word, unsigned Offset, unsigned Width>
+struct endian_bitfield
+{
+private:
+
+    BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<Word>::value && std::is_unsigned<Word>::value );
+    BOOST_ENDIAN_STATIC_ASSERT( Width >= 1 && Offset + Width <= sizeof( Word ) * 8 );
+
+    // the bytes [ first_byte, last_byte ] of the value contain the field,
+    // counting from the least significant one
+
+    static const std::size_t first_byte = Offset / 8;
+    static const std::size_t last_byte = ( Offset + Width - 1 ) / 8;
+
+    static const std::size_t size = last_byte - first_byte + 1;
+
+    static const std::size_t position = Order == order::little? first_byte: sizeof( Word ) - 1 - last_byte;
+
+    static const unsigned shift = Offset % 8;
+
+public:
+
+    typedef Word value_type;
+
+    static const Word mask = static_cast<Word>( static_cast<Word>( ~Word( 0 ) ) >> ( sizeof( Word ) * 8 - Width ) );
+
+    // Requires: p points to sizeof( Word ) bytes
+
+    static Word get( unsigned char const * p ) BOOST_NOEXCEPT
+    {
+        Word w = boost::endian::endian_load<Word, size, Order>( p + position );
+        return static_cast<Word>( ( w >> shift ) & mask );
+    }
+
+    static Word get( unsigned char * p ) BOOST_NOEXCEPT
+    {
+        return get( static_cast<unsigned char const *>( p ) );
+    }
+
+    // Effects: stores the low Width bits of v, leaving the rest of the word unchanged
+
+    static void set( unsigned char * p, Word v ) BOOST_NOEXCEPT
+    {
+        Word w = boost::endian::endian_load<Word, size, Order>( p + position );
+
+        w = static_cast<Word>( w & ~static_cast<Word>( mask << shift ) );
+        w = static_cast<Word>( w | static_cast<Word>( ( v & mask ) << shift ) );
+
+        boost::endian::endian_store<Word, size, Order>( p + position, w );
+    }
+
+    // endian_buffer and endian_arithmetic
+
+    template<class E> static Word get( E const & x ) BOOST_NOEXCEPT
+    {
+        BOOST_ENDIAN_STATIC_ASSERT( sizeof( E ) == sizeof( Word ) );
+        return get( x.data() );
+    }
+
+    template<class E> static void set( E & x, Word v ) BOOST_NOEXCEPT
+    {
+        BOOST_ENDIAN_STATIC_ASSERT( sizeof( E ) == sizeof( Word ) );
+        set( x.data(), v );
+    }
+};
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_BITFIELD_HPP_INCLUDED
@@ -0,0 +1,390 @@
+#ifndef BOOST_ENDIAN_BITPACK_HPP_INCLUDED
+#define BOOST_ENDIAN_BITPACK_HPP_INCLUDED
+
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Bulk packing of unsigned integers of 0 to 32 significant bits into a
+// stream of 32-bit words stored in a given byte order.
+//
+// order::little packs least significant bit first: value i occupies bits
+// [ i * bits, i * bits + bits ) of the stream, counting from the least
+// significant bit of the first little endian word.
+//
+// order::big packs most significant bit first: the first value occupies the
+// most significant bits of the first big endian word. The result is the same
+// as a plain MSB-first bit stream, padded to a multiple of four bytes.
+//
+// pack_msb<Bits> and unpack_msb<Bits> handle the byte-granular MSB-first
+// layout of packed sensor samples (10-, 12- and 14-bit camera and radar
+// data), without padding to a word.
+
+#include <boost/endian/detail/endian_load.hpp>
+#include <boost/endian/detail/endian_store.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace endian
+{
+
+// number of bytes needed to pack n values of the given width
+
+inline std::size_t packed_size( std::size_t n, unsigned bits ) BOOST_NOEXCEPT
+{
+    return ( n * bits + 31 ) / 32 * 4;
+}
+
+namespace detail
+{
+
+// B is a compile time constant, so that the shifts and the masks below are
+// immediates and the loops can be fully specialized for each width
+
+template<order Order, unsigned B> struct bitpack_impl;
+
+template<unsigned B> struct bitpack_impl<order::little, B>
+{
+    static void pack( unsigned char * dst, std::uint32_t const * src, std::size_t n ) BOOST_NOEXCEPT
+    {
+        std::uint64_t const mask = ( std::uint64_t( 1 ) << B ) - 1;
+
+        std::uint64_t acc = 0;
+        unsigned fill = 0;
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            acc |= ( src[ i ] & mask ) << fill;
+            fill += B;
+
+            if( fill >= 32 )
+            {
+                boost::endian::endian_store<std::uint32_t, 4, order::little>( dst, static_cast<std::uint32_t>( acc ) );
+                dst += 4;
+
+                acc >>= 32;
+                fill -= 32;
+            }
+        }
+
+        if( fill > 0 )
+        {
+            boost::endian::endian_store<std::uint32_t, 4, order::little>( dst, static_cast<std::uint32_t>( acc ) );
+        }
+    }
+
+    static void unpack( std::uint32_t * dst, unsigned char const * src, std::size_t n ) BOOST_NOEXCEPT
+    {
+        std::uint64_t const mask = ( std::uint64_t( 1 ) << B ) - 1;
+
+        std::uint64_t acc = 0;
+        unsigned avail = 0;
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            if( avail < B )
+            {
+                acc |= static_cast<std::uint64_t>( boost::endian::endian_load<std::uint32_t, 4, order::little>( src ) ) << avail;
+                src += 4;
+                avail += 32;
+            }
+
+            dst[ i ] = static_cast<std::uint32_t>( acc & mask );
+
+            acc >>= B;
+            avail -= B;
+        }
+    }
+};
+
+template<unsigned B> struct bitpack_impl<order::big, B>
+{
+    static void pack( unsigned char * dst, std::uint32_t const * src, std::size_t n ) BOOST_NOEXCEPT
+    {
+        std::uint64_t const mask = ( std::uint64_t( 1 ) << B ) - 1;
+
+        std::uint64_t acc = 0;
+        unsigned fill = 0;
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            acc = ( acc << B ) | ( src[ i ] & mask );
+            fill += B;
+
+            if( fill >= 32 )
+            {
+                fill -= 32;
+
+                boost::endian::endian_store<std::uint32_t, 4, order::big>( dst, static_cast<std::uint32_t>( acc >> fill ) );
+                dst += 4;
+            }
+        }
+
+        if( fill > 0 )
+        {
+            boost::endian::endian_store<std::uint32_t, 4, order::big>( dst, static_cast<std::uint32_t>( acc << ( 32 - fill ) ) );
+        }
+    }
+
+    static void unpack( std::uint32_t * dst, unsigned char const * src, std::size_t n ) BOOST_NOEXCEPT
+    {
+        std::uint64_t const mask = ( std::uint64_t( 1 ) << B ) - 1;
+
+        std::uint64_t acc = 0;
+        unsigned avail = 0;
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            if( avail < B )
+            {
+                acc = ( acc << 32 ) | boost::endian::endian_load<std::uint32_t, 4, order::big>( src );
+                src += 4;
+                avail += 32;
+            }
+
+            avail -= B;
+
+            dst[ i ] = static_cast<std::uint32_t>( ( acc >> avail ) & mask );
+        }
+    }
+};
+
+// zero width: nothing is stored, everything unpacks to zero
+
+template<> struct bitpack_impl<order::little, 0>
+{
+    static void pack( unsigned char *, std::uint32_t const *, std::size_t ) BOOST_NOEXCEPT
+    {
+    }
+
+    static void unpack( std::uint32_t * dst, unsigned char const *, std::size_t n ) BOOST_NOEXCEPT
+    {
+        for( std::size_t i = 0; i < n; ++i ) dst[ i ] = 0;
+    }
+};
+
+template<> struct bitpack_impl<order::big, 0>: bitpack_impl<order::little, 0>
+{
+};
+
+// maps the runtime width onto the specialization for that width
+
+template<order Order, unsigned B> struct bitpack_dispatch
+{
+    static void pack( unsigned char * dst, std::uint32_t const * src, std::size_t n, unsigned bits ) BOOST_NOEXCEPT
+    {
+        if( bits == B )
+        {
+            bitpack_impl<Order, B>::pack( dst, src, n );
+        }
+        else
+        {
+            bitpack_dispatch<Order, B - 1>::pack( dst, src, n, bits );
+        }
+    }
+
+    static void unpack( std::uint32_t * dst, unsigned char const * src, std::size_t n, unsigned bits ) BOOST_NOEXCEPT
+    {
+        if( bits == B )
+        {
+            bitpack_impl<Order, B>::unpack( dst, src, n );
+        }
+        else
+        {
+            bitpack_dispatch<Order, B - 1>::unpack( dst, src, n, bits );
+        }
+    }
+};
+
+template<order Order> struct bitpack_dispatch<Order, 0>
+{
+    static void pack( unsigned char * dst, std::uint32_t const * src, std::size_t n, unsigned ) BOOST_NOEXCEPT
+    {
+        bitpack_impl<Order, 0>::pack( dst, src, n );
+    }
+
+    static void unpack( std::uint32_t * dst, unsigned char const * src, std::size_t n, unsigned ) BOOST_NOEXCEPT
+    {
+        bitpack_impl<Order, 0>::unpack( dst, src, n );
+    }
+};
+
+} // namespace detail
+
+// Requires:
+//
+//    bits <= 32
+//    src points to n values; bits above the given width are ignored
+//    dst points to packed_size( n, bits ) bytes
+//
+// Effects: packs the n values; the unused bits of the last word are zero
+
+template<order Order>
+inline void pack_bits( unsigned char * dst, std::uint32_t const * src, std::size_t n, unsigned bits ) BOOST_NOEXCEPT
+{
+    detail::bitpack_dispatch<Order, 32>::pack( dst, src, n, bits );
+}
+
+// Requires:
+//
+//    bits <= 32
+//    src points to packed_size( n, bits ) bytes
+//    dst points to storage for n values
+//
+// Effects: unpacks n values; src is not read past packed_size( n, bits )
+
+template<order Order>
+inline void unpack_bits( std::uint32_t * dst, unsigned char const * src, std::size_t n, unsigned bits ) BOOST_NOEXCEPT
+{
+    detail::bitpack_dispatch<Order, 32>::unpack( dst, src, n, bits );
+}
+
+// packed MSB-first samples
+//
+// Groups of four samples occupy Bits / 2 bytes and are transferred with one
+// endian_load or endian_store of that width; a partial group at the end is
+// staged through a small buffer.
+
+inline std::size_t packed_msb_size( std::size_t n, unsigned bits ) BOOST_NOEXCEPT
+{
+    return ( n * bits + 7 ) / 8;
+}
+
+namespace detail
+{
+
+template<unsigned Bits> struct msb_sample_impl
+{
+    BOOST_ENDIAN_STATIC_ASSERT( Bits >= 2 && Bits <= 16 && Bits % 2 == 0 );
+
+    static const std::size_t group = Bits / 2;
+    static const std::uint64_t mask = ( 1u << Bits ) - 1;
+
+    static void unpack_group( std::uint16_t * dst, unsigned char const * src, std::size_t m ) BOOST_NOEXCEPT
+    {
+        std::uint64_t w = boost::endian::endian_load<std::uint64_t, group, order::big>( src );
+
+        for( std::size_t k = 0; k < m; ++k )
+        {
+            dst[ k ] = static_cast<std::uint16_t>( ( w >> ( Bits * ( 3 - k ) ) ) & mask );
+        }
+    }
+
+    static std::uint64_t pack_group( std::uint16_t const * src, std::size_t m ) BOOST_NOEXCEPT
+    {
+        std::uint64_t w = 0;
+
+        for( std::size_t k = 0; k < m; ++k )
+        {
+            w |= static_cast<std::uint64_t>( src[ k ] & mask ) << ( Bits * ( 3 - k ) );
+        }
+
+        return w;
+    }
+};
+
+} // namespace detail
+
+// Requires:
+//
+//    Bits is even, 2 <= Bits <= 16
+//    src points to packed_msb_size( n, Bits ) bytes
+//    dst points to storage for n samples
+
+template<unsigned Bits>
+inline void unpack_msb( std::uint16_t * dst, unsigned char const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    typedef detail::msb_sample_impl<Bits> impl;
+
+    std::size_t i = 0;
+
+    for( ; i + 4 <= n; i += 4, src += impl::group )
+    {
+        impl::unpack_group( dst + i, src, 4 );
+    }
+
+    if( i < n )
+    {
+        unsigned char tmp[ impl::group ] = {};
+
+        std::size_t const m = n - i;
+        std::size_t const k = packed_msb_size( m, Bits );
+
+        for( std::size_t j = 0; j < k; ++j ) tmp[ j ] = src[ j ];
+
+        impl::unpack_group( dst + i, tmp, m );
+    }
+}
+
+// Requires:
+//
+//    Bits is even, 2 <= Bits <= 16
+//    src points to n samples; bits above Bits are ignored
+//    dst points to packed_msb_size( n, Bits ) bytes
+//
+// Effects: the unused bits of the last byte are zero
+
+template<unsigned Bits>
+inline void pack_msb( unsigned char * dst, std::uint16_t const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    typedef detail::msb_sample_impl<Bits> impl;
+
+    std::size_t i = 0;
+
+    for( ; i + 4 <= n; i += 4, dst += impl::group )
+    {
+        boost::endian::endian_store<std::uint64_t, impl::group, order::big>( dst, impl::pack_group( src + i, 4 ) );
+    }
+
+    if( i < n )
+    {
+        unsigned char tmp[ impl::group ];
+
+        std::size_t const m = n - i;
+        std::size_t const k = packed_msb_size( m, Bits );
+
+        boost::endian::endian_store<std::uint64_t, impl::group, order::big>( tmp, impl::pack_group( src + i, m ) );
+
+        for( std::size_t j = 0; j < k; ++j ) dst[ j ] = tmp[ j ];
+    }
+}
+
+inline void unpack_msb10( std::uint16_t * dst, unsigned char const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    boost::endian::unpack_msb<10>( dst, src, n );
+}
+
+inline void unpack_msb12( std::uint16_t * dst, unsigned char const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    boost::endian::unpack_msb<12>( dst, src, n );
+}
+
+inline void unpack_msb14( std::uint16_t * dst, unsigned char const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    boost::endian::unpack_msb<14>( dst, src, n );
+}
+
+inline void pack_msb10( unsigned char * dst, std::uint16_t const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    boost::endian::pack_msb<10>( dst, src, n );
+}
+
+inline void pack_msb12( unsigned char * dst, std::uint16_t const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    boost::endian::pack_msb<12>( dst, src, n );
+}
+
+inline void pack_msb14( unsigned char * dst, std::uint16_t const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    boost::endian::pack_msb<14>( dst, src, n );
+}
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_BITPACK_HPP_INCLUDED
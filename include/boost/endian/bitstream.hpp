@@ -0,0 +1,457 @@
+#ifndef BOOST_ENDIAN_BITSTREAM_HPP_INCLUDED
+#define BOOST_ENDIAN_BITSTREAM_HPP_INCLUDED
+
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Bit stream reader and writer.
+//
+// bit_reader<order::big> and bit_writer<order::big> process bits most
+// significant first (JPEG, H.264, MPEG); the little endian versions process
+// them least significant first (DEFLATE, Vorbis).
+//
+// The reader refills a 64-bit buffer with a single 8-byte endian_load while
+// at least eight bytes (input plus slack) remain, and falls back to a byte
+// at a time only near the end. After refill() at least 56 bits are
+// available, so that up to 56 bits can be peeked and consumed without
+// further checks. Reading past the end of the input sets overrun(); the bits
+// read there are zero, or the contents of the slack bytes if slack was given.
+//
+// The writer stores 8 bytes at a time while there is room for them, so the
+// bytes following the finished output may be overwritten with zeros.
+
+#include <boost/endian/detail/endian_load.hpp>
+#include <boost/endian/detail/endian_store.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace endian
+{
+
+template<order Order> class bit_reader;
+template<order Order> class bit_writer;
+
+namespace detail
+{
+
+// state and operations shared by both bit orders
+
+class bit_reader_base
+{
+protected:
+
+    unsigned char const * begin_;
+    unsigned char const * p_;
+    unsigned char const * end_;
+
+    // refills with an 8-byte load are allowed while p_ < fast_end_
+    unsigned char const * fast_end_;
+
+    std::uint64_t buffer_;
+
+    unsigned bits_;
+    std::size_t pad_;
+
+    bit_reader_base( unsigned char const * p, std::size_t size, std::size_t slack ) BOOST_NOEXCEPT:
+        begin_( p ), p_( p ), end_( p + size ),
+        fast_end_( size + slack >= 8? p + size + slack - 7: p ),
+        buffer_( 0 ), bits_( 0 ), pad_( 0 )
+    {
+    }
+
+public:
+
+    // number of bits consumed so far
+    std::size_t position() const BOOST_NOEXCEPT
+    {
+        return static_cast<std::size_t>( p_ - begin_ ) * 8 + pad_ - bits_;
+    }
+
+    // true if more bits have been consumed than the input holds
+    bool overrun() const BOOST_NOEXCEPT
+    {
+        return position() > static_cast<std::size_t>( end_ - begin_ ) * 8;
+    }
+
+    // number of bits available without a refill
+    unsigned available() const BOOST_NOEXCEPT
+    {
+        return bits_;
+    }
+};
+
+} // namespace detail
+
+template<> class bit_reader<order::big>: public detail::bit_reader_base
+{
+public:
+
+    // Requires: [ p, p + size + slack ) is readable; slack bytes after the
+    // input let the 8-byte refill be used up to its end
+
+    bit_reader( unsigned char const * p, std::size_t size, std::size_t slack = 0 ) BOOST_NOEXCEPT: bit_reader_base( p, size, slack )
+    {
+    }
+
+    // Postconditions: available() >= 56
+
+    void refill() BOOST_NOEXCEPT
+    {
+        if( p_ < fast_end_ )
+        {
+            // bits below the valid ones are the bytes that follow, so OR-ing
+            // them in again on the next refill is harmless
+
+            buffer_ |= boost::endian::endian_load<std::uint64_t, 8, order::big>( p_ ) >> bits_;
+            p_ += ( 63 - bits_ ) >> 3;
+            bits_ |= 56;
+        }
+        else
+        {
+            while( bits_ <= 56 )
+            {
+                std::uint64_t b = 0;
+
+                if( p_ < end_ ) b = *p_++; else pad_ += 8;
+
+                buffer_ |= b << ( 56 - bits_ );
+                bits_ += 8;
+            }
+        }
+    }
+
+    // Requires: n <= available()
+
+    std::uint64_t peek( unsigned n ) const BOOST_NOEXCEPT
+    {
+        return ( buffer_ >> 1 ) >> ( 63 - n );
+    }
+
+    void consume( unsigned n ) BOOST_NOEXCEPT
+    {
+        buffer_ <<= n;
+        bits_ -= n;
+    }
+
+    // Requires: n <= 56
+
+    std::uint64_t read( unsigned n ) BOOST_NOEXCEPT
+    {
+        if( bits_ < n ) refill();
+
+        std::uint64_t r = peek( n );
+        consume( n );
+
+        return r;
+    }
+
+    // reads count values of the given width; bits <= 32
+
+    void read_n( std::uint32_t * dst, std::size_t count, unsigned bits ) BOOST_NOEXCEPT
+    {
+        if( bits == 0 )
+        {
+            for( std::size_t i = 0; i < count; ++i ) dst[ i ] = 0;
+            return;
+        }
+
+        std::size_t const k = 56 / bits;
+
+        std::size_t i = 0;
+
+        while( i < count )
+        {
+            refill();
+
+            std::size_t m = count - i < k? count - i: k;
+
+            for( std::size_t j = 0; j < m; ++j )
+            {
+                dst[ i + j ] = static_cast<std::uint32_t>( peek( bits ) );
+                consume( bits );
+            }
+
+            i += m;
+        }
+    }
+
+    void align_to_byte() BOOST_NOEXCEPT
+    {
+        consume( bits_ & 7 );
+    }
+};
+
+template<> class bit_reader<order::little>: public detail::bit_reader_base
+{
+public:
+
+    bit_reader( unsigned char const * p, std::size_t size, std::size_t slack = 0 ) BOOST_NOEXCEPT: bit_reader_base( p, size, slack )
+    {
+    }
+
+    void refill() BOOST_NOEXCEPT
+    {
+        if( p_ < fast_end_ )
+        {
+            buffer_ |= boost::endian::endian_load<std::uint64_t, 8, order::little>( p_ ) << bits_;
+            p_ += ( 63 - bits_ ) >> 3;
+            bits_ |= 56;
+        }
+        else
+        {
+            while( bits_ <= 56 )
+            {
+                std::uint64_t b = 0;
+
+                if( p_ < end_ ) b = *p_++; else pad_ += 8;
+
+                buffer_ |= b << bits_;
+                bits_ += 8;
+            }
+        }
+    }
+
+    std::uint64_t peek( unsigned n ) const BOOST_NOEXCEPT
+    {
+        return buffer_ & ( ( std::uint64_t( 1 ) << n ) - 1 );
+    }
+
+    void consume( unsigned n ) BOOST_NOEXCEPT
+    {
+        buffer_ >>= n;
+        bits_ -= n;
+    }
+
+    std::uint64_t read( unsigned n ) BOOST_NOEXCEPT
+    {
+        if( bits_ < n ) refill();
+
+        std::uint64_t r = peek( n );
+        consume( n );
+
+        return r;
+    }
+
+    void read_n( std::uint32_t * dst, std::size_t count, unsigned bits ) BOOST_NOEXCEPT
+    {
+        if( bits == 0 )
+        {
+            for( std::size_t i = 0; i < count; ++i ) dst[ i ] = 0;
+            return;
+        }
+
+        std::size_t const k = 56 / bits;
+
+        std::size_t i = 0;
+
+        while( i < count )
+        {
+            refill();
+
+            std::size_t m = count - i < k? count - i: k;
+
+            for( std::size_t j = 0; j < m; ++j )
+            {
+                dst[ i + j ] = static_cast<std::uint32_t>( peek( bits ) );
+                consume( bits );
+            }
+
+            i += m;
+        }
+    }
+
+    void align_to_byte() BOOST_NOEXCEPT
+    {
+        consume( bits_ & 7 );
+    }
+};
+
+namespace detail
+{
+
+class bit_writer_base
+{
+protected:
+
+    unsigned char * begin_;
+    unsigned char * p_;
+    unsigned char * end_;
+
+    std::uint64_t buffer_;
+
+    unsigned bits_;
+    bool overflow_;
+
+    bit_writer_base( unsigned char * p, std::size_t size ) BOOST_NOEXCEPT:
+        begin_( p ), p_( p ), end_( p + size ), buffer_( 0 ), bits_( 0 ), overflow_( false )
+    {
+    }
+
+    // stores the first n bytes of the 8-byte representation in tmp
+
+    void put_bytes( unsigned char const * tmp, std::size_t n ) BOOST_NOEXCEPT
+    {
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            if( p_ == end_ )
+            {
+                overflow_ = true;
+                return;
+            }
+
+            *p_++ = tmp[ i ];
+        }
+    }
+
+public:
+
+    // number of bits written so far
+    std::size_t position() const BOOST_NOEXCEPT
+    {
+        return static_cast<std::size_t>( p_ - begin_ ) * 8 + bits_;
+    }
+
+    // true if the output was too small
+    bool overflow() const BOOST_NOEXCEPT
+    {
+        return overflow_;
+    }
+};
+
+} // namespace detail
+
+// bits are accumulated most significant first in the top of the buffer
+
+template<> class bit_writer<order::big>: public detail::bit_writer_base
+{
+private:
+
+    void flush() BOOST_NOEXCEPT
+    {
+        std::size_t n = bits_ >> 3;
+
+        if( end_ - p_ >= 8 )
+        {
+            boost::endian::endian_store<std::uint64_t, 8, order::big>( p_, buffer_ );
+            p_ += n;
+        }
+        else
+        {
+            unsigned char tmp[ 8 ];
+            boost::endian::endian_store<std::uint64_t, 8, order::big>( tmp, buffer_ );
+            put_bytes( tmp, n );
+        }
+
+        // after finish() rounds up, all 64 bits may have been written out
+        buffer_ = n == 8? 0: buffer_ << ( n * 8 );
+        bits_ &= 7;
+    }
+
+public:
+
+    bit_writer( unsigned char * p, std::size_t size ) BOOST_NOEXCEPT: bit_writer_base( p, size )
+    {
+    }
+
+    // Requires: n <= 56; bits of v above n are ignored
+
+    void write( std::uint64_t v, unsigned n ) BOOST_NOEXCEPT
+    {
+        if( bits_ + n > 63 ) flush();
+
+        v &= ( std::uint64_t( 1 ) << n ) - 1;
+
+        buffer_ |= ( v << 1 ) << ( 63 - bits_ - n );
+        bits_ += n;
+    }
+
+    // writes count values of the given width; bits <= 32
+
+    void write_n( std::uint32_t const * src, std::size_t count, unsigned bits ) BOOST_NOEXCEPT
+    {
+        for( std::size_t i = 0; i < count; ++i )
+        {
+            write( src[ i ], bits );
+        }
+    }
+
+    // pads to a byte boundary with zero bits and writes out the buffer
+    // Returns: the number of bytes written
+
+    std::size_t finish() BOOST_NOEXCEPT
+    {
+        bits_ = ( bits_ + 7 ) & ~7u;
+        flush();
+
+        return static_cast<std::size_t>( p_ - begin_ );
+    }
+};
+
+// bits are accumulated least significant first in the bottom of the buffer
+
+template<> class bit_writer<order::little>: public detail::bit_writer_base
+{
+private:
+
+    void flush() BOOST_NOEXCEPT
+    {
+        std::size_t n = bits_ >> 3;
+
+        if( end_ - p_ >= 8 )
+        {
+            boost::endian::endian_store<std::uint64_t, 8, order::little>( p_, buffer_ );
+            p_ += n;
+        }
+        else
+        {
+            unsigned char tmp[ 8 ];
+            boost::endian::endian_store<std::uint64_t, 8, order::little>( tmp, buffer_ );
+            put_bytes( tmp, n );
+        }
+
+        buffer_ = n == 8? 0: buffer_ >> ( n * 8 );
+        bits_ &= 7;
+    }
+
+public:
+
+    bit_writer( unsigned char * p, std::size_t size ) BOOST_NOEXCEPT: bit_writer_base( p, size )
+    {
+    }
+
+    void write( std::uint64_t v, unsigned n ) BOOST_NOEXCEPT
+    {
+        if( bits_ + n > 63 ) flush();
+
+        v &= ( std::uint64_t( 1 ) << n ) - 1;
+
+        buffer_ |= v << bits_;
+        bits_ += n;
+    }
+
+    void write_n( std::uint32_t const * src, std::size_t count, unsigned bits ) BOOST_NOEXCEPT
+    {
+        for( std::size_t i = 0; i < count; ++i )
+        {
+            write( src[ i ], bits );
+        }
+    }
+
+    std::size_t finish() BOOST_NOEXCEPT
+    {
+        bits_ = ( bits_ + 7 ) & ~7u;
+        flush();
+
+        return static_cast<std::size_t>( p_ - begin_ );
+    }
+};
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_BITSTREAM_HPP_INCLUDED
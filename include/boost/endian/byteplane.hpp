@@ -0,0 +1,132 @@
+#ifndef BOOST_ENDIAN_BYTEPLANE_HPP_INCLUDED
+#define BOOST_ENDIAN_BYTEPLANE_HPP_INCLUDED
+
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Byte plane shuffle and unshuffle, as used as a filter in front of general
+// purpose compressors.
+//
+// Planes are numbered by significance: plane 0 holds the least significant
+// byte of every value, plane W-1 the most significant one. Since the planes
+// do not depend on the byte order of the values they came from, splitting
+// values of one order and merging into the other converts between the two
+// in the same pass.
+
+#include <boost/endian/detail/order.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/endian/buffers.hpp>
+#include <boost/config.hpp>
+#include <cstddef>
+
+namespace boost
+{
+namespace endian
+{
+
+namespace detail
+{
+
+// offset, within a W-byte value of the given order, of the byte of significance K
+
+template<order Order, std::size_t W, std::size_t K> struct byteplane_offset
+{
+    static const std::size_t value = Order == order::little? K: W - 1 - K;
+};
+
+template<order Order, std::size_t W, std::size_t K> struct byteplane_impl
+{
+    static void split( unsigned char * dst, unsigned char const * src, std::size_t n ) BOOST_NOEXCEPT
+    {
+        byteplane_impl<Order, W, K - 1>::split( dst, src, n );
+
+        unsigned char * d = dst + ( K - 1 ) * n;
+        unsigned char const * s = src + byteplane_offset<Order, W, K - 1>::value;
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            d[ i ] = s[ i * W ];
+        }
+    }
+
+    static void merge( unsigned char * dst, unsigned char const * src, std::size_t n ) BOOST_NOEXCEPT
+    {
+        byteplane_impl<Order, W, K - 1>::merge( dst, src, n );
+
+        unsigned char * d = dst + byteplane_offset<Order, W, K - 1>::value;
+        unsigned char const * s = src + ( K - 1 ) * n;
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            d[ i * W ] = s[ i ];
+        }
+    }
+};
+
+template<order Order, std::size_t W> struct byteplane_impl<Order, W, 0>
+{
+    static void split( unsigned char *, unsigned char const *, std::size_t ) BOOST_NOEXCEPT
+    {
+    }
+
+    static void merge( unsigned char *, unsigned char const *, std::size_t ) BOOST_NOEXCEPT
+    {
+    }
+};
+
+} // namespace detail
+
+// Requires:
+//
+//    1 <= W <= 8
+//    src points to n W-byte values in byte order Order
+//    dst points to W * n bytes; plane k is stored at dst + k * n
+//    the ranges do not overlap
+
+template<order Order, std::size_t W>
+inline void byteplane_split( unsigned char * dst, unsigned char const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( W >= 1 && W <= 8 );
+
+    // one plane at a time keeps both the reads and the writes sequential,
+    // with a constant stride the compiler can turn into shuffles
+
+    detail::byteplane_impl<Order, W, W>::split( dst, src, n );
+}
+
+// Requires:
+//
+//    1 <= W <= 8
+//    src points to W planes of n bytes each, plane k at src + k * n
+//    dst points to storage for n W-byte values, written in byte order Order
+//    the ranges do not overlap
+
+template<order Order, std::size_t W>
+inline void byteplane_merge( unsigned char * dst, unsigned char const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( W >= 1 && W <= 8 );
+
+    detail::byteplane_impl<Order, W, W>::merge( dst, src, n );
+}
+
+// overloads for arrays of endian_buffer
+
+template<order Order, class T, std::size_t n_bits, align A>
+inline void byteplane_split( unsigned char * dst, endian_buffer<Order, T, n_bits, A> const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof( endian_buffer<Order, T, n_bits, A> ) == n_bits / 8 );
+    boost::endian::byteplane_split<Order, n_bits / 8>( dst, reinterpret_cast<unsigned char const*>( src ), n );
+}
+
+template<order Order, class T, std::size_t n_bits, align A>
+inline void byteplane_merge( endian_buffer<Order, T, n_bits, A> * dst, unsigned char const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof( endian_buffer<Order, T, n_bits, A> ) == n_bits / 8 );
+    boost::endian::byteplane_merge<Order, n_bits / 8>( reinterpret_cast<unsigned char*>( dst ), src, n );
+}
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_BYTEPLANE_HPP_INCLUDED
@@ -0,0 +1,250 @@
+#ifndef BOOST_ENDIAN_CODEC_HPP_INCLUDED
+#define BOOST_ENDIAN_CODEC_HPP_INCLUDED
+
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Lightweight integer codecs (delta, frame of reference, run length) that
+// read and write arrays of N-byte values in a given byte order.
+//
+// The byte order conversion happens in the same loop as the coding step;
+// no native-order copy of the data is made.
+
+#include <boost/endian/detail/endian_load.hpp>
+#include <boost/endian/detail/endian_store.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/endian/buffers.hpp>
+#include <boost/endian/reduce.hpp>
+#include <boost/config.hpp>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+namespace boost
+{
+namespace endian
+{
+
+// Requires (for all functions below, unless noted otherwise):
+//
+//    T, N, Order as for endian_load; T is integral
+//    src points to n consecutive N-byte values
+//    dst points to storage for n consecutive N-byte values; dst may be equal
+//    to src, but the two ranges must not otherwise overlap
+//
+// Arithmetic is performed modulo 2^(8*N), so that encoding followed by
+// decoding reproduces the input exactly.
+
+// delta coding
+//
+// endian_delta_encode: dst[ i ] = src[ i ] - src[ i - 1 ], with src[ -1 ] = prev
+// endian_delta_decode: dst[ i ] = dst[ i - 1 ] + src[ i ], with dst[ -1 ] = prev
+//
+// Returns: the last decoded value, to be passed as prev for the next block
+
+template<class T, std::size_t N, order Order>
+inline T endian_delta_encode( unsigned char * dst, unsigned char const * src, std::size_t n, T prev = 0 ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value );
+
+    typedef typename std::make_unsigned<T>::type U;
+
+    for( std::size_t i = 0; i < n; ++i, src += N, dst += N )
+    {
+        T x = boost::endian::endian_load<T, N, Order>( src );
+
+        boost::endian::endian_store<U, N, Order>( dst, static_cast<U>( static_cast<U>( x ) - static_cast<U>( prev ) ) );
+
+        prev = x;
+    }
+
+    return prev;
+}
+
+template<class T, std::size_t N, order Order>
+inline T endian_delta_decode( unsigned char * dst, unsigned char const * src, std::size_t n, T prev = 0 ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value );
+
+    typedef typename std::make_unsigned<T>::type U;
+
+    U acc = static_cast<U>( prev );
+
+    for( std::size_t i = 0; i < n; ++i, src += N, dst += N )
+    {
+        acc = static_cast<U>( acc + boost::endian::endian_load<U, N, Order>( src ) );
+
+        boost::endian::endian_store<U, N, Order>( dst, acc );
+    }
+
+    // reload through T to obtain the sign-extended N-byte value
+
+    unsigned char tmp[ N ];
+    boost::endian::endian_store<U, N, order::little>( tmp, acc );
+
+    return boost::endian::endian_load<T, N, order::little>( tmp );
+}
+
+// frame of reference coding
+//
+// endian_for_encode: dst[ i ] = src[ i ] - min( src ); n must be at least 1
+// endian_for_decode: dst[ i ] = src[ i ] + reference
+//
+// The offsets are nonnegative and at most range, which gives the number of
+// significant bits per offset for a subsequent bit packing step.
+
+template<class T> struct endian_frame
+{
+    T reference;
+    typename std::make_unsigned<T>::type range;
+};
+
+template<class T, std::size_t N, order Order>
+inline endian_frame<T> endian_for_encode( unsigned char * dst, unsigned char const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value );
+
+    typedef typename std::make_unsigned<T>::type U;
+
+    std::pair<T, T> mm = boost::endian::endian_minmax<T, N, Order>( src, n );
+
+    U const ref = static_cast<U>( mm.first );
+
+    for( std::size_t i = 0; i < n; ++i, src += N, dst += N )
+    {
+        T x = boost::endian::endian_load<T, N, Order>( src );
+        boost::endian::endian_store<U, N, Order>( dst, static_cast<U>( static_cast<U>( x ) - ref ) );
+    }
+
+    endian_frame<T> r = { mm.first, static_cast<U>( static_cast<U>( mm.second ) - ref ) };
+    return r;
+}
+
+template<class T, std::size_t N, order Order>
+inline void endian_for_decode( unsigned char * dst, unsigned char const * src, std::size_t n, T reference ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value );
+
+    typedef typename std::make_unsigned<T>::type U;
+
+    U const ref = static_cast<U>( reference );
+
+    for( std::size_t i = 0; i < n; ++i, src += N, dst += N )
+    {
+        boost::endian::endian_store<U, N, Order>( dst, static_cast<U>( boost::endian::endian_load<U, N, Order>( src ) + ref ) );
+    }
+}
+
+// run length coding
+//
+// endian_rle_encode: splits src into runs of equal values; the first value
+// of each run is copied to values (in the original byte order) and its length
+// to lengths. values and lengths must have room for n runs. Runs longer than
+// 2^32-1 are split.
+//
+// Equality does not depend on byte order, so values are compared as bytes
+// and never reversed.
+//
+// Returns: the number of runs
+//
+// endian_rle_decode: expands runs into native values of type T.
+//
+// Returns: the number of values written to dst
+
+template<std::size_t N>
+inline std::size_t endian_rle_encode( unsigned char * values, std::uint32_t * lengths, unsigned char const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    std::size_t r = 0;
+
+    std::size_t i = 0;
+
+    while( i < n )
+    {
+        unsigned char const * v = src + i * N;
+
+        std::size_t j = i + 1;
+
+        while( j < n && j - i < 0xFFFFFFFFu && std::memcmp( src + j * N, v, N ) == 0 )
+        {
+            ++j;
+        }
+
+        std::memcpy( values + r * N, v, N );
+        lengths[ r ] = static_cast<std::uint32_t>( j - i );
+
+        ++r;
+        i = j;
+    }
+
+    return r;
+}
+
+template<class T, std::size_t N, order Order>
+inline std::size_t endian_rle_decode( T * dst, unsigned char const * values, std::uint32_t const * lengths, std::size_t runs ) BOOST_NOEXCEPT
+{
+    std::size_t r = 0;
+
+    for( std::size_t i = 0; i < runs; ++i, values += N )
+    {
+        T const x = boost::endian::endian_load<T, N, Order>( values );
+
+        for( std::uint32_t k = 0; k < lengths[ i ]; ++k )
+        {
+            dst[ r++ ] = x;
+        }
+    }
+
+    return r;
+}
+
+// overloads for arrays of endian_buffer
+
+template<order Order, class T, std::size_t n_bits, align A>
+inline T endian_delta_encode( endian_buffer<Order, T, n_bits, A> * dst, endian_buffer<Order, T, n_bits, A> const * src, std::size_t n, T prev = 0 ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof( endian_buffer<Order, T, n_bits, A> ) == n_bits / 8 );
+    return boost::endian::endian_delta_encode<T, n_bits / 8, Order>( reinterpret_cast<unsigned char*>( dst ), reinterpret_cast<unsigned char const*>( src ), n, prev );
+}
+
+template<order Order, class T, std::size_t n_bits, align A>
+inline T endian_delta_decode( endian_buffer<Order, T, n_bits, A> * dst, endian_buffer<Order, T, n_bits, A> const * src, std::size_t n, T prev = 0 ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof( endian_buffer<Order, T, n_bits, A> ) == n_bits / 8 );
+    return boost::endian::endian_delta_decode<T, n_bits / 8, Order>( reinterpret_cast<unsigned char*>( dst ), reinterpret_cast<unsigned char const*>( src ), n, prev );
+}
+
+template<order Order, class T, std::size_t n_bits, align A>
+inline endian_frame<T> endian_for_encode( endian_buffer<Order, T, n_bits, A> * dst, endian_buffer<Order, T, n_bits, A> const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof( endian_buffer<Order, T, n_bits, A> ) == n_bits / 8 );
+    return boost::endian::endian_for_encode<T, n_bits / 8, Order>( reinterpret_cast<unsigned char*>( dst ), reinterpret_cast<unsigned char const*>( src ), n );
+}
+
+template<order Order, class T, std::size_t n_bits, align A>
+inline void endian_for_decode( endian_buffer<Order, T, n_bits, A> * dst, endian_buffer<Order, T, n_bits, A> const * src, std::size_t n, T reference ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof( endian_buffer<Order, T, n_bits, A> ) == n_bits / 8 );
+    boost::endian::endian_for_decode<T, n_bits / 8, Order>( reinterpret_cast<unsigned char*>( dst ), reinterpret_cast<unsigned char const*>( src ), n, reference );
+}
+
+template<order Order, class T, std::size_t n_bits, align A>
+inline std::size_t endian_rle_encode( endian_buffer<Order, T, n_bits, A> * values, std::uint32_t * lengths, endian_buffer<Order, T, n_bits, A> const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof( endian_buffer<Order, T, n_bits, A> ) == n_bits / 8 );
+    return boost::endian::endian_rle_encode<n_bits / 8>( reinterpret_cast<unsigned char*>( values ), lengths, reinterpret_cast<unsigned char const*>( src ), n );
+}
+
+template<order Order, class T, std::size_t n_bits, align A>
+inline std::size_t endian_rle_decode( T * dst, endian_buffer<Order, T, n_bits, A> const * values, std::uint32_t const * lengths, std::size_t runs ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof( endian_buffer<Order, T, n_bits, A> ) == n_bits / 8 );
+    return boost::endian::endian_rle_decode<T, n_bits / 8, Order>( dst, reinterpret_cast<unsigned char const*>( values ), lengths, runs );
+}
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_CODEC_HPP_INCLUDED
@@ -0,0 +1,286 @@
+#ifndef BOOST_ENDIAN_CONVERT_HPP_INCLUDED
+#define BOOST_ENDIAN_CONVERT_HPP_INCLUDED
+
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Bulk conversion between arrays of N-byte values stored in a given byte
+// order and native arrays of another arithmetic type:
+//
+//    endian_convert<T, N, Order>( D * dst, unsigned char const * src, n )
+//
+// loads each value as T, sign or zero extending it when N < sizeof(T), and
+// casts it to D (widening int16 to int64, int16 to float, and so on) in the
+// same loop; endian_convert_store is the reverse.
+//
+// endian_saturate narrows like endian_convert_store, but clamps the values
+// that do not fit in N bytes instead of wrapping, and reports them.
+//
+// Values of odd widths are extracted from an unaligned 8-byte load with a
+// shift and a mask, rather than assembled a byte at a time, everywhere but
+// at the end of the array.
+
+#include <boost/endian/detail/endian_load.hpp>
+#include <boost/endian/detail/endian_store.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/endian/buffers.hpp>
+#include <boost/config.hpp>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace endian
+{
+
+namespace detail
+{
+
+template<class T, std::size_t N, order Order, bool Odd = ( N < sizeof( T ) )> struct endian_convert_impl
+{
+    template<class D> static void load( D * dst, unsigned char const * src, std::size_t n ) BOOST_NOEXCEPT
+    {
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            dst[ i ] = static_cast<D>( boost::endian::endian_load<T, N, Order>( src + i * N ) );
+        }
+    }
+};
+
+template<class T, std::size_t N, order Order> struct endian_convert_impl<T, N, Order, true>
+{
+    BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value );
+
+    // the value at p, in the low 8 * N bits
+
+    static std::uint64_t extract( unsigned char const * p, std::integral_constant<order, order::little> ) BOOST_NOEXCEPT
+    {
+        return boost::endian::endian_load<std::uint64_t, 8, order::little>( p ) & ( ( std::uint64_t( 1 ) << ( 8 * N ) ) - 1 );
+    }
+
+    static std::uint64_t extract( unsigned char const * p, std::integral_constant<order, order::big> ) BOOST_NOEXCEPT
+    {
+        return boost::endian::endian_load<std::uint64_t, 8, order::big>( p ) >> ( 64 - 8 * N );
+    }
+
+    template<class D> static void load( D * dst, unsigned char const * src, std::size_t n ) BOOST_NOEXCEPT
+    {
+        std::uint64_t const sign = std::is_signed<T>::value? std::uint64_t( 1 ) << ( 8 * N - 1 ): 0;
+
+        std::size_t i = 0;
+
+        // while the 8-byte load stays within the array
+
+        for( ; n * N >= 8 && i <= ( n * N - 8 ) / N; ++i )
+        {
+            std::uint64_t v = extract( src + i * N, std::integral_constant<order, Order>() );
+
+            v = ( v ^ sign ) - sign;
+
+            dst[ i ] = static_cast<D>( static_cast<T>( static_cast<std::int64_t>( v ) ) );
+        }
+
+        for( ; i < n; ++i )
+        {
+            dst[ i ] = static_cast<D>( boost::endian::endian_load<T, N, Order>( src + i * N ) );
+        }
+    }
+};
+
+// saturation bounds of an N-byte T, and the clamping of a source value to
+// them, written as selects so that the loops below can be vectorized
+
+template<class T, std::size_t N> struct endian_saturate_bounds
+{
+    BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value && N >= 1 && N <= sizeof( T ) );
+
+    static const bool is_signed = std::is_signed<T>::value;
+
+    // hi as unsigned, lo as signed
+    static const std::uint64_t hi = is_signed? ( std::uint64_t( 1 ) << ( 8 * N - 1 ) ) - 1: ~std::uint64_t( 0 ) >> ( 64 - 8 * N );
+    static const std::int64_t lo = is_signed? -static_cast<std::int64_t>( hi ) - 1: 0;
+
+    // signed integral source
+    template<class S> static T clamp( S s, bool & overflow, std::true_type, std::true_type ) BOOST_NOEXCEPT
+    {
+        std::int64_t const v = s;
+        std::int64_t const l = lo;
+        std::uint64_t const h = hi;
+
+        bool const below = v < l;
+        bool const above = v > 0 && static_cast<std::uint64_t>( v ) > h;
+
+        overflow = below || above;
+
+        return below? static_cast<T>( l ): above? static_cast<T>( h ): static_cast<T>( v );
+    }
+
+    // unsigned integral source
+    template<class S> static T clamp( S s, bool & overflow, std::true_type, std::false_type ) BOOST_NOEXCEPT
+    {
+        std::uint64_t const v = s;
+        std::uint64_t const h = hi;
+
+        overflow = v > h;
+
+        return overflow? static_cast<T>( h ): static_cast<T>( v );
+    }
+
+    // floating point source, truncated toward zero; NaN becomes zero
+    template<class S, class B> static T clamp( S s, bool & overflow, std::false_type, B ) BOOST_NOEXCEPT
+    {
+        // lo and hi + 1 are powers of two, exactly representable in S
+        S const half = static_cast<S>( std::uint64_t( 1 ) << ( 8 * N - 1 ) );
+
+        S const lower = is_signed? -half: S( 0 );
+        S const upper = is_signed? half: 2 * half;
+
+        std::int64_t const l = lo;
+        std::uint64_t const h = hi;
+
+        // s truncates into range when lower - 1 < s < upper. lower - 1 is
+        // not exact in S when lower is too large; it then rounds to lower,
+        // which s >= lower covers. False for NaN.
+        S const below = lower - 1;
+
+        bool const in_range = ( s >= lower || s > below ) && s < upper;
+
+        overflow = !in_range;
+
+        return in_range? static_cast<T>( s ): s < lower? static_cast<T>( l ): s >= upper? static_cast<T>( h ): T( 0 );
+    }
+
+    template<class S> static T clamp( S s, bool & overflow ) BOOST_NOEXCEPT
+    {
+        return clamp( s, overflow, std::is_integral<S>(), std::is_signed<S>() );
+    }
+};
+
+} // namespace detail
+
+// Requires:
+//
+//    T, N, Order as for endian_load
+//    src points to n consecutive N-byte values
+//    dst points to storage for n values
+//
+// Effects: dst[ i ] = static_cast<D>( endian_load<T, N, Order>( src + i * N ) )
+
+template<class T, std::size_t N, order Order, class D>
+inline void endian_convert( D * dst, unsigned char const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    detail::endian_convert_impl<T, N, Order>::load( dst, src, n );
+}
+
+// Requires:
+//
+//    T, N, Order as for endian_store
+//    every src[ i ] is representable as T (see endian_saturate otherwise)
+//    dst points to storage for n N-byte values
+//
+// Effects: endian_store<T, N, Order>( dst + i * N, static_cast<T>( src[ i ] ) )
+
+template<class T, std::size_t N, order Order, class S>
+inline void endian_convert_store( unsigned char * dst, S const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        boost::endian::endian_store<T, N, Order>( dst + i * N, static_cast<T>( src[ i ] ) );
+    }
+}
+
+// Requires:
+//
+//    T is integral; N, Order as for endian_store
+//    dst points to storage for n N-byte values
+//
+// Effects: stores src[ i ] clamped to the range of an N-byte T; floating
+// point values are truncated toward zero, and NaN is stored as zero
+//
+// Returns: the number of values that did not fit
+
+template<class T, std::size_t N, order Order, class S>
+inline std::size_t endian_saturate( unsigned char * dst, S const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    std::size_t r = 0;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        bool overflow;
+        T const v = detail::endian_saturate_bounds<T, N>::clamp( src[ i ], overflow );
+
+        boost::endian::endian_store<T, N, Order>( dst + i * N, v );
+        r += overflow;
+    }
+
+    return r;
+}
+
+// As above; additionally, bit i % 64 of mask[ i / 64 ] is set if src[ i ]
+// did not fit, and cleared otherwise. mask points to ( n + 63 ) / 64 words.
+
+template<class T, std::size_t N, order Order, class S>
+inline std::size_t endian_saturate( unsigned char * dst, S const * src, std::size_t n, std::uint64_t * mask ) BOOST_NOEXCEPT
+{
+    std::size_t r = 0;
+
+    for( std::size_t i = 0; i < n; i += 64 )
+    {
+        std::size_t const m = n - i < 64? n - i: 64;
+
+        std::uint64_t w = 0;
+
+        for( std::size_t j = 0; j < m; ++j )
+        {
+            bool overflow;
+            T const v = detail::endian_saturate_bounds<T, N>::clamp( src[ i + j ], overflow );
+
+            boost::endian::endian_store<T, N, Order>( dst + ( i + j ) * N, v );
+            w |= static_cast<std::uint64_t>( overflow ) << j;
+        }
+
+        mask[ i / 64 ] = w;
+
+        for( ; w != 0; w &= w - 1 ) ++r;
+    }
+
+    return r;
+}
+
+// overloads for arrays of endian_buffer
+
+template<order Order, class T, std::size_t n_bits, align A, class D>
+inline void endian_convert( D * dst, endian_buffer<Order, T, n_bits, A> const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof( endian_buffer<Order, T, n_bits, A> ) == n_bits / 8 );
+    boost::endian::endian_convert<T, n_bits / 8, Order>( dst, reinterpret_cast<unsigned char const*>( src ), n );
+}
+
+template<order Order, class T, std::size_t n_bits, align A, class S>
+inline void endian_convert_store( endian_buffer<Order, T, n_bits, A> * dst, S const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof( endian_buffer<Order, T, n_bits, A> ) == n_bits / 8 );
+    boost::endian::endian_convert_store<T, n_bits / 8, Order>( reinterpret_cast<unsigned char*>( dst ), src, n );
+}
+
+template<order Order, class T, std::size_t n_bits, align A, class S>
+inline std::size_t endian_saturate( endian_buffer<Order, T, n_bits, A> * dst, S const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof( endian_buffer<Order, T, n_bits, A> ) == n_bits / 8 );
+    return boost::endian::endian_saturate<T, n_bits / 8, Order>( reinterpret_cast<unsigned char*>( dst ), src, n );
+}
+
+template<order Order, class T, std::size_t n_bits, align A, class S>
+inline std::size_t endian_saturate( endian_buffer<Order, T, n_bits, A> * dst, S const * src, std::size_t n, std::uint64_t * mask ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof( endian_buffer<Order, T, n_bits, A> ) == n_bits / 8 );
+    return boost::endian::endian_saturate<T, n_bits / 8, Order>( reinterpret_cast<unsigned char*>( dst ), src, n, mask );
+}
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_CONVERT_HPP_INCLUDED
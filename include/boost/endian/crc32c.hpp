@@ -0,0 +1,231 @@
+#ifndef BOOST_ENDIAN_CRC32C_HPP_INCLUDED
+#define BOOST_ENDIAN_CRC32C_HPP_INCLUDED
+
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// CRC-32C (Castagnoli) of a byte range, and conversions of arrays of values
+// stored in a given byte order that compute the CRC of the stored bytes in
+// the same pass, so that a checksummed frame is verified and decoded with a
+// single trip through memory.
+//
+// The conversions work in blocks of about 2K: the CRC of a block is computed
+// and the block converted while it is still in the L1 cache.
+//
+// The CRC uses the SSE4.2 crc32 instruction when it is available, and a
+// slicing-by-8 table otherwise.
+
+#include <boost/endian/detail/endian_load.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/endian/detail/intrinsic.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/endian/buffers.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(__SSE4_2__) && !defined(BOOST_ENDIAN_NO_INTRINSICS)
+# include <nmmintrin.h>
+# define BOOST_ENDIAN_CRC32C_SSE42
+#endif
+
+namespace boost
+{
+namespace endian
+{
+
+namespace detail
+{
+
+#if defined(BOOST_ENDIAN_CRC32C_SSE42)
+
+inline std::uint32_t crc32c_update( std::uint32_t crc, unsigned char const * p, std::size_t n ) BOOST_NOEXCEPT
+{
+#if defined(__x86_64__) || defined(_M_X64)
+
+    std::uint64_t c = crc;
+
+    for( ; n >= 8; n -= 8, p += 8 )
+    {
+        c = _mm_crc32_u64( c, boost::endian::endian_load<std::uint64_t, 8, order::little>( p ) );
+    }
+
+    crc = static_cast<std::uint32_t>( c );
+
+#endif
+
+    for( ; n >= 4; n -= 4, p += 4 )
+    {
+        crc = _mm_crc32_u32( crc, boost::endian::endian_load<std::uint32_t, 4, order::little>( p ) );
+    }
+
+    for( ; n > 0; --n, ++p )
+    {
+        crc = _mm_crc32_u8( crc, *p );
+    }
+
+    return crc;
+}
+
+#else
+
+// table[ k ][ b ] is the CRC of byte b followed by k zero bytes
+
+template<class = void> struct crc32c_table
+{
+    std::uint32_t table[ 8 ][ 256 ];
+
+    crc32c_table() BOOST_NOEXCEPT
+    {
+        for( std::uint32_t b = 0; b < 256; ++b )
+        {
+            std::uint32_t c = b;
+
+            for( int i = 0; i < 8; ++i )
+            {
+                c = ( c >> 1 ) ^ ( 0x82F63B78u & ( 0u - ( c & 1 ) ) );
+            }
+
+            table[ 0 ][ b ] = c;
+        }
+
+        for( std::uint32_t b = 0; b < 256; ++b )
+        {
+            for( int k = 1; k < 8; ++k )
+            {
+                std::uint32_t const c = table[ k - 1 ][ b ];
+                table[ k ][ b ] = ( c >> 8 ) ^ table[ 0 ][ c & 0xFF ];
+            }
+        }
+    }
+
+    static crc32c_table const & get() BOOST_NOEXCEPT
+    {
+        static const crc32c_table t;
+        return t;
+    }
+};
+
+inline std::uint32_t crc32c_update( std::uint32_t crc, unsigned char const * p, std::size_t n ) BOOST_NOEXCEPT
+{
+    std::uint32_t const (*t)[ 256 ] = crc32c_table<>::get().table;
+
+    for( ; n >= 8; n -= 8, p += 8 )
+    {
+        std::uint32_t const lo = crc ^ boost::endian::endian_load<std::uint32_t, 4, order::little>( p );
+        std::uint32_t const hi = boost::endian::endian_load<std::uint32_t, 4, order::little>( p + 4 );
+
+        crc = t[ 7 ][ lo & 0xFF ] ^ t[ 6 ][ ( lo >> 8 ) & 0xFF ] ^ t[ 5 ][ ( lo >> 16 ) & 0xFF ] ^ t[ 4 ][ lo >> 24 ]
+            ^ t[ 3 ][ hi & 0xFF ] ^ t[ 2 ][ ( hi >> 8 ) & 0xFF ] ^ t[ 1 ][ ( hi >> 16 ) & 0xFF ] ^ t[ 0 ][ hi >> 24 ];
+    }
+
+    for( ; n > 0; --n, ++p )
+    {
+        crc = ( crc >> 8 ) ^ t[ 0 ][ ( crc ^ *p ) & 0xFF ];
+    }
+
+    return crc;
+}
+
+#endif
+
+// elements per block of the fused conversions
+
+template<std::size_t N> struct crc32c_block
+{
+    static const std::size_t value = 2048 / N;
+};
+
+} // namespace detail
+
+// Returns: the CRC-32C of [ p, p + n ); passing the result of a previous
+// call as crc continues the computation over a following range
+
+inline std::uint32_t crc32c( unsigned char const * p, std::size_t n, std::uint32_t crc = 0 ) BOOST_NOEXCEPT
+{
+    return ~detail::crc32c_update( ~crc, p, n );
+}
+
+// Requires:
+//
+//    T, N, Order as for endian_load
+//    src points to n consecutive N-byte values
+//    dst points to storage for n values
+//
+// Effects: dst[ i ] = endian_load<T, N, Order>( src + i * N )
+//
+// Returns: crc32c( src, n * N, crc )
+
+template<class T, std::size_t N, order Order>
+inline std::uint32_t endian_load_crc32c( T * dst, unsigned char const * src, std::size_t n, std::uint32_t crc = 0 ) BOOST_NOEXCEPT
+{
+    std::size_t const block = detail::crc32c_block<N>::value;
+
+    std::uint32_t c = ~crc;
+
+    for( std::size_t i = 0; i < n; i += block )
+    {
+        std::size_t const m = n - i < block? n - i: block;
+
+        unsigned char const * p = src + i * N;
+
+        c = detail::crc32c_update( c, p, m * N );
+
+        for( std::size_t j = 0; j < m; ++j )
+        {
+            dst[ i + j ] = boost::endian::endian_load<T, N, Order>( p + j * N );
+        }
+    }
+
+    return ~c;
+}
+
+// Requires:
+//
+//    T is integral, an enum or floating point
+//    p points to n values of T stored in byte order Order
+//
+// Effects: converts the values to native order in place, as
+//          conditional_reverse_inplace<Order, order::native> does
+//
+// Returns: the CRC-32C of the bytes of the values as they were stored
+
+template<order Order, class T>
+inline std::uint32_t endian_crc32c_inplace( T * p, std::size_t n, std::uint32_t crc = 0 ) BOOST_NOEXCEPT
+{
+    std::size_t const block = detail::crc32c_block<sizeof( T )>::value;
+
+    std::uint32_t c = ~crc;
+
+    for( std::size_t i = 0; i < n; i += block )
+    {
+        std::size_t const m = n - i < block? n - i: block;
+
+        c = detail::crc32c_update( c, reinterpret_cast<unsigned char const*>( p + i ), m * sizeof( T ) );
+
+        if( Order != order::native )
+        {
+            for( std::size_t j = 0; j < m; ++j )
+            {
+                p[ i + j ] = boost::endian::endian_load<T, sizeof( T ), Order>( reinterpret_cast<unsigned char const*>( p + i + j ) );
+            }
+        }
+    }
+
+    return ~c;
+}
+
+// overload for arrays of endian_buffer
+
+template<order Order, class T, std::size_t n_bits, align A>
+inline std::uint32_t endian_load_crc32c( T * dst, endian_buffer<Order, T, n_bits, A> const * src, std::size_t n, std::uint32_t crc = 0 ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof( endian_buffer<Order, T, n_bits, A> ) == n_bits / 8 );
+    return boost::endian::endian_load_crc32c<T, n_bits / 8, Order>( dst, reinterpret_cast<unsigned char const*>( src ), n, crc );
+}
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_CRC32C_HPP_INCLUDED
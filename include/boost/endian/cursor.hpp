@@ -0,0 +1,376 @@
+#ifndef BOOST_ENDIAN_CURSOR_HPP_INCLUDED
+#define BOOST_ENDIAN_CURSOR_HPP_INCLUDED
+
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Cursors for reading and writing messages made of values in a given byte
+// order:
+//
+//    reader<order::big> r( p, size );
+//
+//    std::uint16_t type;
+//    std::uint32_t length;
+//    std::int64_t timestamp;
+//
+//    if( !r.read( type, length, timestamp ) ) return false;
+//
+// The grouped read checks the bounds once for the whole group instead of
+// once per field. Errors are sticky: a read or write that does not fit does
+// nothing but move the cursor to the end and clear ok(), so that checking
+// ok() once after a sequence of calls is enough. endian_cursor, in
+// format_reader.hpp, is reader<Order>.
+//
+// When Checked is false (trusted_reader, trusted_writer) the bounds are not
+// checked at all; the caller guarantees that the data is large enough, for
+// example because a frame length has been validated already.
+//
+// A writer either fills a fixed buffer or appends to a std::vector, growing
+// it as needed; in the latter case the vector is trimmed to the bytes
+// written when the writer is destroyed.
+
+#include <boost/endian/detail/endian_load.hpp>
+#include <boost/endian/detail/endian_store.hpp>
+#include <boost/endian/detail/endian_array.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/config.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+namespace boost
+{
+namespace endian
+{
+
+namespace detail
+{
+
+template<class... T> struct cursor_size;
+
+template<> struct cursor_size<>
+{
+    static const std::size_t value = 0;
+};
+
+template<class T, class... R> struct cursor_size<T, R...>
+{
+    static const std::size_t value = sizeof( T ) + cursor_size<R...>::value;
+};
+
+} // namespace detail
+
+template<order Order, bool Checked = true> class reader
+{
+private:
+
+    unsigned char const * begin_;
+    unsigned char const * p_;
+    unsigned char const * end_;
+
+    bool ok_;
+
+    bool fits( std::size_t n ) BOOST_NOEXCEPT
+    {
+        if( !Checked || n <= static_cast<std::size_t>( end_ - p_ ) ) return true;
+
+        p_ = end_;
+        ok_ = false;
+
+        return false;
+    }
+
+    template<class T> int load( T & v ) BOOST_NOEXCEPT
+    {
+        v = boost::endian::endian_load<T, sizeof( T ), Order>( p_ );
+        p_ += sizeof( T );
+
+        return 0;
+    }
+
+public:
+
+    static BOOST_CONSTEXPR_OR_CONST order byte_order = Order;
+
+    reader( unsigned char const * p, std::size_t size ) BOOST_NOEXCEPT: begin_( p ), p_( p ), end_( p + size ), ok_( true )
+    {
+    }
+
+    // Requires: sizeof(T) is 1, 2, 4 or 8; 1 <= N <= sizeof(T)
+    // Returns: the value read, or T() if it does not fit
+
+    template<class T, std::size_t N> T read() BOOST_NOEXCEPT
+    {
+        if( !fits( N ) ) return T();
+
+        T r = boost::endian::endian_load<T, N, Order>( p_ );
+        p_ += N;
+
+        return r;
+    }
+
+    template<class T> T read() BOOST_NOEXCEPT
+    {
+        return read<T, sizeof( T )>();
+    }
+
+    // reads each of v... in turn, at its full size
+    // Returns: false, reading nothing, if they do not all fit
+
+    template<class... T> bool read( T&... v ) BOOST_NOEXCEPT
+    {
+        if( !fits( detail::cursor_size<T...>::value ) ) return false;
+
+        int const r[] = { 0, load( v )... };
+        (void)r;
+
+        return true;
+    }
+
+    // reads n values of type T into dst
+    // Returns: false, reading nothing, if they do not fit
+
+    template<class T> bool read_array( T * dst, std::size_t n ) BOOST_NOEXCEPT
+    {
+        if( Checked && n > static_cast<std::size_t>( end_ - p_ ) / sizeof( T ) )
+        {
+            p_ = end_;
+            ok_ = false;
+
+            return false;
+        }
+
+        detail::endian_load_array_impl<T, Order>::call( dst, p_, n );
+        p_ += n * sizeof( T );
+
+        return true;
+    }
+
+    bool skip( std::size_t n ) BOOST_NOEXCEPT
+    {
+        if( !fits( n ) ) return false;
+
+        p_ += n;
+        return true;
+    }
+
+    // moves to an absolute offset, such as a TIFF IFD offset
+
+    bool seek( std::size_t offset ) BOOST_NOEXCEPT
+    {
+        p_ = begin_;
+        return skip( offset );
+    }
+
+    // a reader over the same data at an absolute offset, leaving this one
+    // where it is; not ok() if the offset is past the end
+
+    reader at( std::size_t offset ) const BOOST_NOEXCEPT
+    {
+        reader r( begin_, static_cast<std::size_t>( end_ - begin_ ) );
+        r.seek( offset );
+
+        return r;
+    }
+
+    std::size_t tell() const BOOST_NOEXCEPT
+    {
+        return static_cast<std::size_t>( p_ - begin_ );
+    }
+
+    std::size_t remaining() const BOOST_NOEXCEPT
+    {
+        return static_cast<std::size_t>( end_ - p_ );
+    }
+
+    unsigned char const * data() const BOOST_NOEXCEPT
+    {
+        return p_;
+    }
+
+    bool ok() const BOOST_NOEXCEPT
+    {
+        return ok_;
+    }
+};
+
+template<order Order, bool Checked = true> class writer
+{
+private:
+
+    unsigned char * begin_;
+    unsigned char * p_;
+    unsigned char * end_;
+
+    std::vector<unsigned char> * v_;
+
+    // the offset in *v_ of the first byte written by this writer
+    std::size_t start_;
+
+    bool ok_;
+
+    bool fits( std::size_t n )
+    {
+        if( !Checked || n <= static_cast<std::size_t>( end_ - p_ ) ) return true;
+
+        if( v_ )
+        {
+            grow( n );
+            return true;
+        }
+
+        p_ = end_;
+        ok_ = false;
+
+        return false;
+    }
+
+    void grow( std::size_t n )
+    {
+        std::size_t const offset = static_cast<std::size_t>( p_ - begin_ );
+        std::size_t const size = v_->size();
+
+        v_->resize( offset + n > 2 * size? offset + n: 2 * size );
+
+        begin_ = v_->data();
+        p_ = begin_ + offset;
+        end_ = begin_ + v_->size();
+    }
+
+    template<class T> int store( T const & v ) BOOST_NOEXCEPT
+    {
+        boost::endian::endian_store<T, sizeof( T ), Order>( p_, v );
+        p_ += sizeof( T );
+
+        return 0;
+    }
+
+public:
+
+    static BOOST_CONSTEXPR_OR_CONST order byte_order = Order;
+
+    // writes to [ p, p + size )
+
+    writer( unsigned char * p, std::size_t size ) BOOST_NOEXCEPT: begin_( p ), p_( p ), end_( p + size ), v_( 0 ), start_( 0 ), ok_( true )
+    {
+    }
+
+    // appends to v; when Checked is false, the caller reserves space in
+    // advance with reserve()
+
+    explicit writer( std::vector<unsigned char> & v ): begin_( 0 ), p_( 0 ), end_( 0 ), v_( &v ), start_( v.size() ), ok_( true )
+    {
+        v.resize( start_ + 64 );
+
+        begin_ = v.data();
+        p_ = begin_ + start_;
+        end_ = begin_ + v.size();
+    }
+
+    writer( writer const & ) = delete;
+    writer & operator=( writer const & ) = delete;
+
+    ~writer()
+    {
+        if( v_ ) v_->resize( start_ + tell() );
+    }
+
+    // Requires: sizeof(T) is 1, 2, 4 or 8; 1 <= N <= sizeof(T)
+    // Returns: false, writing nothing, if the value does not fit
+
+    template<class T, std::size_t N> bool write( T const & v )
+    {
+        if( !fits( N ) ) return false;
+
+        boost::endian::endian_store<T, N, Order>( p_, v );
+        p_ += N;
+
+        return true;
+    }
+
+    // writes each of v... in turn, at its full size
+    // Returns: false, writing nothing, if they do not all fit
+
+    template<class... T> bool write( T const&... v )
+    {
+        if( !fits( detail::cursor_size<T...>::value ) ) return false;
+
+        int const r[] = { 0, store( v )... };
+        (void)r;
+
+        return true;
+    }
+
+    // writes n values of type T from src
+    // Returns: false, writing nothing, if they do not fit
+
+    template<class T> bool write_array( T const * src, std::size_t n )
+    {
+        if( Checked && n > static_cast<std::size_t>( -1 ) / sizeof( T ) )
+        {
+            p_ = end_;
+            ok_ = false;
+
+            return false;
+        }
+
+        if( !fits( n * sizeof( T ) ) ) return false;
+
+        detail::endian_store_array_impl<T, Order>::call( p_, src, n );
+        p_ += n * sizeof( T );
+
+        return true;
+    }
+
+    // writes n bytes already in wire order
+
+    bool write_bytes( void const * src, std::size_t n )
+    {
+        if( !fits( n ) ) return false;
+
+        if( n != 0 ) std::memcpy( p_, src, n );
+        p_ += n;
+
+        return true;
+    }
+
+    // ensures that n more bytes fit, when writing to a vector
+
+    void reserve( std::size_t n )
+    {
+        if( v_ && n > static_cast<std::size_t>( end_ - p_ ) ) grow( n );
+    }
+
+    // Returns: the number of bytes written; when appending to a vector, the
+    // bytes that were already in it are not counted
+
+    std::size_t tell() const BOOST_NOEXCEPT
+    {
+        return static_cast<std::size_t>( p_ - begin_ ) - start_;
+    }
+
+    std::size_t remaining() const BOOST_NOEXCEPT
+    {
+        return static_cast<std::size_t>( end_ - p_ );
+    }
+
+    unsigned char * data() const BOOST_NOEXCEPT
+    {
+        return p_;
+    }
+
+    bool ok() const BOOST_NOEXCEPT
+    {
+        return ok_;
+    }
+};
+
+template<order Order> using trusted_reader = reader<Order, false>;
+template<order Order> using trusted_writer = writer<Order, false>;
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_CURSOR_HPP_INCLUDED
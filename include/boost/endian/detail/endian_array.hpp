@@ -0,0 +1,72 @@
+#ifndef BOOST_ENDIAN_DETAIL_ENDIAN_ARRAY_HPP_INCLUDED
+#define BOOST_ENDIAN_DETAIL_ENDIAN_ARRAY_HPP_INCLUDED
+
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/detail/endian_load.hpp>
+#include <boost/endian/detail/endian_store.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/config.hpp>
+#include <cstddef>
+#include <cstring>
+
+namespace boost
+{
+namespace endian
+{
+
+namespace detail
+{
+
+// converts n values of type T stored in the given order; a plain copy when
+// the order is native, otherwise a loop of byte swaps that compilers turn
+// into vector shuffles
+
+template<class T, order Order, bool Native = Order == order::native> struct endian_load_array_impl
+{
+    static void call( T * dst, unsigned char const * src, std::size_t n ) BOOST_NOEXCEPT
+    {
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            dst[ i ] = boost::endian::endian_load<T, sizeof( T ), Order>( src + i * sizeof( T ) );
+        }
+    }
+};
+
+template<class T, order Order> struct endian_load_array_impl<T, Order, true>
+{
+    static void call( T * dst, unsigned char const * src, std::size_t n ) BOOST_NOEXCEPT
+    {
+        if( n != 0 ) std::memcpy( dst, src, n * sizeof( T ) );
+    }
+};
+
+// the reverse of endian_load_array_impl
+
+template<class T, order Order, bool Native = Order == order::native> struct endian_store_array_impl
+{
+    static void call( unsigned char * dst, T const * src, std::size_t n ) BOOST_NOEXCEPT
+    {
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            boost::endian::endian_store<T, sizeof( T ), Order>( dst + i * sizeof( T ), src[ i ] );
+        }
+    }
+};
+
+template<class T, order Order> struct endian_store_array_impl<T, Order, true>
+{
+    static void call( unsigned char * dst, T const * src, std::size_t n ) BOOST_NOEXCEPT
+    {
+        if( n != 0 ) std::memcpy( dst, src, n * sizeof( T ) );
+    }
+};
+
+} // namespace detail
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_DETAIL_ENDIAN_ARRAY_HPP_INCLUDED
@@ -0,0 +1,148 @@
+#ifndef BOOST_ENDIAN_FORMAT_READER_HPP_INCLUDED
+#define BOOST_ENDIAN_FORMAT_READER_HPP_INCLUDED
+
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Support for file formats that declare their byte order in a header, such
+// as TIFF ("II" or "MM") and ELF (EI_DATA).
+//
+// The reader is written once, as a function object whose call operator is a
+// template over the cursor type:
+//
+//    struct tiff_reader
+//    {
+//        template<order Order> bool operator()( endian_cursor<Order> c ) const
+//        {
+//            c.skip( 4 );
+//            std::uint32_t ifd = c.template read<std::uint32_t>();
+//            // ...
+//        }
+//    };
+//
+//    order o;
+//    if( tiff_order( p, size, o ) ) read_with_order( o, p, size, tiff_reader() );
+//
+// read_with_order calls it with an endian_cursor<order::little> or an
+// endian_cursor<order::big>, so that every load in the reader has a byte
+// order known at compile time.
+
+#include <boost/endian/cursor.hpp>
+#include <boost/endian/detail/endian_load.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace endian
+{
+
+// A bounds checked read position in [ p, p + size ), reading values stored
+// in the byte order Order; see reader in cursor.hpp.
+
+template<order Order> using endian_cursor = reader<Order>;
+
+// Requires: o is order::little or order::big
+//
+// Returns: f( endian_cursor<o>( p, size ) )
+
+template<class F>
+inline auto read_with_order( order o, unsigned char const * p, std::size_t size, F f ) -> decltype( f( endian_cursor<order::little>( p, size ) ) )
+{
+    if( o == order::big )
+    {
+        return f( endian_cursor<order::big>( p, size ) );
+    }
+    else
+    {
+        return f( endian_cursor<order::little>( p, size ) );
+    }
+}
+
+// order detection
+
+// Effects: if the N bytes at p hold magic in big endian order, sets o to
+// order::big; if they hold it in little endian order, to order::little.
+// Returns: whether the order was recognized. magic must not be a palindrome.
+
+template<class T, std::size_t N>
+inline bool detect_order( unsigned char const * p, T magic, order & o ) BOOST_NOEXCEPT
+{
+    T const v = boost::endian::endian_load<T, N, order::big>( p );
+
+    if( v == magic )
+    {
+        o = order::big;
+        return true;
+    }
+
+    if( boost::endian::endian_load<T, N, order::little>( p ) == magic )
+    {
+        o = order::little;
+        return true;
+    }
+
+    return false;
+}
+
+template<class T>
+inline bool detect_order( unsigned char const * p, T magic, order & o ) BOOST_NOEXCEPT
+{
+    return boost::endian::detect_order<T, sizeof( T )>( p, magic, o );
+}
+
+// TIFF: "II" or "MM", followed by 42 (or 43 for BigTIFF) in that order
+
+inline bool tiff_order( unsigned char const * p, std::size_t size, order & o ) BOOST_NOEXCEPT
+{
+    if( size < 4 ) return false;
+
+    if( p[ 0 ] == 'I' && p[ 1 ] == 'I' )
+    {
+        o = order::little;
+    }
+    else if( p[ 0 ] == 'M' && p[ 1 ] == 'M' )
+    {
+        o = order::big;
+    }
+    else
+    {
+        return false;
+    }
+
+    std::uint16_t const version = o == order::little? boost::endian::endian_load<std::uint16_t, 2, order::little>( p + 2 ): boost::endian::endian_load<std::uint16_t, 2, order::big>( p + 2 );
+
+    return version == 42 || version == 43;
+}
+
+// ELF: "\x7F" "ELF", then EI_CLASS, then EI_DATA, 1 for little, 2 for big
+
+inline bool elf_order( unsigned char const * p, std::size_t size, order & o ) BOOST_NOEXCEPT
+{
+    if( size < 6 || p[ 0 ] != 0x7F || p[ 1 ] != 'E' || p[ 2 ] != 'L' || p[ 3 ] != 'F' ) return false;
+
+    switch( p[ 5 ] )
+    {
+    case 1:
+
+        o = order::little;
+        return true;
+
+    case 2:
+
+        o = order::big;
+        return true;
+
+    default:
+
+        return false;
+    }
+}
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_FORMAT_READER_HPP_INCLUDED
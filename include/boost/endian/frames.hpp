@@ -0,0 +1,208 @@
+#ifndef BOOST_ENDIAN_FRAMES_HPP_INCLUDED
+#define BOOST_ENDIAN_FRAMES_HPP_INCLUDED
+
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Splitting of a byte stream into frames, each made of an N-byte length in
+// a given byte order followed by that many bytes of payload.
+//
+// split_frames calls a function for each complete frame of a buffer, with
+// a pointer into the buffer and the size of the payload; frame_splitter
+// does the same for a stream received in chunks of any size:
+//
+//    frame_splitter<4> s( 1 << 20 );
+//
+//    while( ( n = ::recv( fd, buffer, sizeof( buffer ), 0 ) ) > 0 )
+//    {
+//        s.feed( buffer, n, []( unsigned char const * p, std::size_t size ){ ... } );
+//        if( !s.ok() ) break;
+//    }
+//
+// Frames that lie entirely within a chunk are passed to the function where
+// they are, without a copy; only a frame cut by the end of a chunk is
+// copied, to be completed by the next ones. The pointers passed remain
+// valid only during the call.
+
+#include <boost/endian/detail/endian_load.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/config.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace endian
+{
+
+// Requires:
+//
+//    1 <= N <= 8
+//    f( unsigned char const * payload, std::size_t size ) is valid
+//
+// Effects: calls f for each complete frame at the start of [ p, p + n ), in
+// order, stopping at an incomplete frame or at a length above max_size
+//
+// Returns: the number of bytes of the complete frames
+
+template<std::size_t N, order Order, class F>
+inline std::size_t split_frames( unsigned char const * p, std::size_t n, F f, std::size_t max_size = static_cast<std::size_t>( -1 ) )
+{
+    BOOST_ENDIAN_STATIC_ASSERT( N >= 1 && N <= 8 );
+
+    std::size_t i = 0;
+
+    while( n - i >= N )
+    {
+        std::uint64_t const size = boost::endian::endian_load<std::uint64_t, N, Order>( p + i );
+
+        if( size > max_size || size > n - i - N ) break;
+
+        f( p + i + N, static_cast<std::size_t>( size ) );
+        i += N + static_cast<std::size_t>( size );
+    }
+
+    return i;
+}
+
+template<std::size_t N, order Order = order::big> class frame_splitter
+{
+private:
+
+    BOOST_ENDIAN_STATIC_ASSERT( N >= 1 && N <= 8 );
+
+    // the start of a frame cut by the end of the last chunk
+    std::vector<unsigned char> partial_;
+
+    std::size_t max_size_;
+
+    bool ok_;
+
+    // moves bytes from [ p, p + n ) to partial_ until it holds a complete
+    // frame, or until the input is exhausted
+    // Returns: the number of bytes used
+
+    std::size_t complete( unsigned char const * p, std::size_t n )
+    {
+        std::size_t i = 0;
+
+        if( partial_.size() < N )
+        {
+            std::size_t const k = N - partial_.size() < n? N - partial_.size(): n;
+
+            partial_.insert( partial_.end(), p, p + k );
+            i = k;
+
+            if( partial_.size() < N ) return i;
+        }
+
+        std::uint64_t const size = boost::endian::endian_load<std::uint64_t, N, Order>( partial_.data() );
+
+        if( size > max_size_ || size > static_cast<std::size_t>( -1 ) - N )
+        {
+            ok_ = false;
+            return n;
+        }
+
+        std::size_t const missing = static_cast<std::size_t>( N + size - partial_.size() );
+        std::size_t const k = missing < n - i? missing: n - i;
+
+        partial_.insert( partial_.end(), p + i, p + i + k );
+
+        return i + k;
+    }
+
+public:
+
+    static BOOST_CONSTEXPR_OR_CONST order byte_order = Order;
+
+    // frames longer than max_size are an error
+
+    explicit frame_splitter( std::size_t max_size = static_cast<std::size_t>( -1 ) ): max_size_( max_size ), ok_( true )
+    {
+    }
+
+    // Requires: f( unsigned char const * payload, std::size_t size ) is valid
+    //
+    // Effects: calls f for each frame completed by [ p, p + n ), in order,
+    // and keeps the bytes of the last one if it is incomplete
+    //
+    // Returns: the number of frames passed to f
+
+    template<class F> std::size_t feed( unsigned char const * p, std::size_t n, F f )
+    {
+        if( !ok_ ) return 0;
+
+        std::size_t r = 0;
+
+        if( !partial_.empty() )
+        {
+            std::size_t const k = complete( p, n );
+
+            if( !ok_ ) return 0;
+
+            p += k;
+            n -= k;
+
+            if( partial_.size() < N || partial_.size() - N < boost::endian::endian_load<std::uint64_t, N, Order>( partial_.data() ) )
+            {
+                return 0;
+            }
+
+            f( partial_.data() + N, partial_.size() - N );
+            partial_.clear();
+
+            ++r;
+        }
+
+        struct counter
+        {
+            F & f;
+            std::size_t & r;
+
+            void operator()( unsigned char const * q, std::size_t m )
+            {
+                f( q, m );
+                ++r;
+            }
+        };
+
+        counter const c = { f, r };
+
+        std::size_t const k = boost::endian::split_frames<N, Order>( p, n, c, max_size_ );
+
+        // the rest is an incomplete frame, or one that is too long
+
+        if( k != n ) complete( p + k, n - k );
+
+        return r;
+    }
+
+    // the number of bytes of an incomplete frame held
+
+    std::size_t buffered() const BOOST_NOEXCEPT
+    {
+        return partial_.size();
+    }
+
+    // false after a frame longer than max_size; feed then does nothing
+
+    bool ok() const BOOST_NOEXCEPT
+    {
+        return ok_;
+    }
+
+    void reset() BOOST_NOEXCEPT
+    {
+        partial_.clear();
+        ok_ = true;
+    }
+};
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_FRAMES_HPP_INCLUDED
@@ -0,0 +1,302 @@
+#ifndef BOOST_ENDIAN_GATHER_HPP_INCLUDED
+#define BOOST_ENDIAN_GATHER_HPP_INCLUDED
+
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Serialization of a message as a list of segments for a gathering write
+// (writev, sendmsg, WSASend), so that large payloads already in wire order
+// are sent from where they are instead of being copied:
+//
+//    gather_writer<order::big> g;
+//
+//    std::size_t length = g.placeholder<std::uint32_t>();
+//
+//    g.write( std::uint16_t( type ), std::uint16_t( flags ) );
+//    g.reference( payload, payload_size );
+//    g.write( crc );
+//
+//    g.patch<std::uint32_t>( length, static_cast<std::uint32_t>( g.size() ) );
+//
+//    iovec iov[ 16 ];
+//    ::writev( fd, iov, static_cast<int>( g.to_iovec( iov, 16 ) ) );
+//
+// The values written are stored with endian_store into a small arena inside
+// the object; consecutive values share one segment. The arena and the list
+// of segments are fixed arrays, so that building a message never allocates.
+// A write that does not fit does nothing but clear ok(), as with writer.
+//
+// Since segments point into the arena, a gather_writer cannot be copied.
+
+#include <boost/endian/detail/endian_store.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/endian/cursor.hpp>
+#include <boost/config.hpp>
+#include <cstddef>
+#include <cstring>
+
+namespace boost
+{
+namespace endian
+{
+
+struct gather_segment
+{
+    void const * data;
+    std::size_t size;
+};
+
+template<order Order, std::size_t ArenaSize = 256, std::size_t MaxSegments = 16> class gather_writer
+{
+private:
+
+    BOOST_ENDIAN_STATIC_ASSERT( ArenaSize > 0 && MaxSegments > 0 );
+
+    unsigned char arena_[ ArenaSize ];
+    std::size_t used_;
+
+    gather_segment segments_[ MaxSegments ];
+    std::size_t count_;
+
+    std::size_t size_;
+
+    // whether the last segment is in the arena, ending at arena_ + used_,
+    // and where in the arena it starts
+    bool last_in_arena_;
+    std::size_t last_start_;
+
+    bool ok_;
+
+    // reserves n bytes of the arena, extending the last segment when it
+    // ends where they start
+    // Returns: the reserved bytes, or 0 if they do not fit
+
+    unsigned char * allocate( std::size_t n ) BOOST_NOEXCEPT
+    {
+        if( n > ArenaSize - used_ )
+        {
+            ok_ = false;
+            return 0;
+        }
+
+        unsigned char * p = arena_ + used_;
+
+        if( n == 0 ) return p;
+
+        if( last_in_arena_ )
+        {
+            segments_[ count_ - 1 ].size = used_ + n - last_start_;
+        }
+        else if( count_ < MaxSegments )
+        {
+            gather_segment s = { p, n };
+            segments_[ count_++ ] = s;
+
+            last_in_arena_ = true;
+            last_start_ = used_;
+        }
+        else
+        {
+            ok_ = false;
+            return 0;
+        }
+
+        used_ += n;
+        size_ += n;
+
+        return p;
+    }
+
+    template<class T> int store( unsigned char * & p, T const & v ) BOOST_NOEXCEPT
+    {
+        boost::endian::endian_store<T, sizeof( T ), Order>( p, v );
+        p += sizeof( T );
+
+        return 0;
+    }
+
+public:
+
+    static BOOST_CONSTEXPR_OR_CONST order byte_order = Order;
+
+    gather_writer() BOOST_NOEXCEPT: used_( 0 ), count_( 0 ), size_( 0 ), last_in_arena_( false ), last_start_( 0 ), ok_( true )
+    {
+    }
+
+    gather_writer( gather_writer const & ) = delete;
+    gather_writer & operator=( gather_writer const & ) = delete;
+
+    // Requires: sizeof(T) is 1, 2, 4 or 8; 1 <= N <= sizeof(T)
+    // Returns: false, writing nothing, if the value does not fit
+
+    template<class T, std::size_t N> bool write( T const & v ) BOOST_NOEXCEPT
+    {
+        unsigned char * p = allocate( N );
+
+        if( p == 0 ) return false;
+
+        boost::endian::endian_store<T, N, Order>( p, v );
+
+        return true;
+    }
+
+    // writes each of v... in turn, at its full size, into one segment
+    // Returns: false, writing nothing, if they do not all fit
+
+    template<class... T> bool write( T const&... v ) BOOST_NOEXCEPT
+    {
+        unsigned char * p = allocate( detail::cursor_size<T...>::value );
+
+        if( p == 0 ) return false;
+
+        int const r[] = { 0, store( p, v )... };
+        (void)r;
+
+        return true;
+    }
+
+    // copies n bytes into the arena; for small pieces not worth a segment
+
+    bool write_bytes( void const * src, std::size_t n ) BOOST_NOEXCEPT
+    {
+        unsigned char * p = allocate( n );
+
+        if( p == 0 ) return false;
+
+        if( n != 0 ) std::memcpy( p, src, n );
+
+        return true;
+    }
+
+    // adds a segment referring to [ src, src + n ), which must stay valid
+    // and unchanged until the message has been sent
+
+    bool reference( void const * src, std::size_t n ) BOOST_NOEXCEPT
+    {
+        if( n == 0 ) return true;
+
+        if( count_ == MaxSegments )
+        {
+            ok_ = false;
+            return false;
+        }
+
+        gather_segment s = { src, n };
+        segments_[ count_++ ] = s;
+
+        last_in_arena_ = false;
+        size_ += n;
+
+        return true;
+    }
+
+    // writes a zero N-byte T to be set with patch later, such as a length
+    // prefix that depends on what follows
+    // Returns: its position in the arena, or ArenaSize if it does not fit
+
+    template<class T, std::size_t N> std::size_t placeholder() BOOST_NOEXCEPT
+    {
+        unsigned char * p = allocate( N );
+
+        if( p == 0 ) return ArenaSize;
+
+        std::memset( p, 0, N );
+
+        return static_cast<std::size_t>( p - arena_ );
+    }
+
+    template<class T> std::size_t placeholder() BOOST_NOEXCEPT
+    {
+        return placeholder<T, sizeof( T )>();
+    }
+
+    // Requires: position was returned by placeholder<T, N>
+    // Effects: stores v at position; does nothing if position is ArenaSize
+
+    template<class T, std::size_t N> void patch( std::size_t position, T const & v ) BOOST_NOEXCEPT
+    {
+        if( position < ArenaSize ) boost::endian::endian_store<T, N, Order>( arena_ + position, v );
+    }
+
+    template<class T> void patch( std::size_t position, T const & v ) BOOST_NOEXCEPT
+    {
+        patch<T, sizeof( T )>( position, v );
+    }
+
+    // total size of the message
+
+    std::size_t size() const BOOST_NOEXCEPT
+    {
+        return size_;
+    }
+
+    gather_segment const * segments() const BOOST_NOEXCEPT
+    {
+        return segments_;
+    }
+
+    std::size_t segment_count() const BOOST_NOEXCEPT
+    {
+        return count_;
+    }
+
+    // Requires: Iovec has the members iov_base and iov_len of struct iovec
+    // Effects: if segment_count() <= n, fills out[ 0 .. segment_count() )
+    //          with the segments; otherwise leaves out unchanged
+    // Returns: the number of entries filled; 0 when the segments do not all
+    //          fit, so that a partial message is never sent
+
+    template<class Iovec> std::size_t to_iovec( Iovec * out, std::size_t n ) const BOOST_NOEXCEPT
+    {
+        if( count_ > n ) return 0;
+
+        for( std::size_t i = 0; i < count_; ++i )
+        {
+            out[ i ].iov_base = const_cast<void*>( segments_[ i ].data );
+            out[ i ].iov_len = segments_[ i ].size;
+        }
+
+        return count_;
+    }
+
+    // copies the message to dst, which has room for size() bytes
+
+    void copy_to( unsigned char * dst ) const BOOST_NOEXCEPT
+    {
+        for( std::size_t i = 0; i < count_; ++i )
+        {
+            std::memcpy( dst, segments_[ i ].data, segments_[ i ].size );
+            dst += segments_[ i ].size;
+        }
+    }
+
+    // empties the message, for reuse
+
+    void clear() BOOST_NOEXCEPT
+    {
+        used_ = 0;
+        count_ = 0;
+        size_ = 0;
+        last_in_arena_ = false;
+        ok_ = true;
+    }
+
+    bool ok() const BOOST_NOEXCEPT
+    {
+        return ok_;
+    }
+};
+
+// Returns: the number of bytes that write( v... ) adds to a message
+
+template<class... T> BOOST_CONSTEXPR std::size_t gather_size( T const&... ) BOOST_NOEXCEPT
+{
+    return detail::cursor_size<T...>::value;
+}
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_GATHER_HPP_INCLUDED
@@ -0,0 +1,159 @@
+#ifndef BOOST_ENDIAN_HISTOGRAM_HPP_INCLUDED
+#define BOOST_ENDIAN_HISTOGRAM_HPP_INCLUDED
+
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Histograms over keys stored in a given byte order, and batched updates
+// of counter arrays stored in a given byte order.
+
+#include <boost/endian/detail/endian_load.hpp>
+#include <boost/endian/detail/endian_store.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/endian/arithmetic.hpp>
+#include <boost/endian/buffers.hpp>
+#include <boost/config.hpp>
+#include <type_traits>
+#include <cstddef>
+
+namespace boost
+{
+namespace endian
+{
+
+// Requires:
+//
+//    T, N, Order as for endian_load; T is integral
+//    p points to n consecutive N-byte keys
+//    bins points to nbins counters
+//
+// Effects: ++bins[ k ] for every key k < nbins
+//
+// Returns: the number of keys that were not counted because k >= nbins;
+//          negative keys are out of range
+
+template<class T, std::size_t N, order Order, class C>
+inline std::size_t endian_histogram( C * bins, std::size_t nbins, unsigned char const * p, std::size_t n ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value );
+
+    std::size_t r = 0;
+
+    std::size_t i = 0;
+
+    // the keys of a group are loaded before any counter is touched, so the
+    // reversals are not serialized behind the increments
+
+    for( ; i + 4 <= n; i += 4, p += 4 * N )
+    {
+        std::size_t k0 = static_cast<std::size_t>( boost::endian::endian_load<T, N, Order>( p ) );
+        std::size_t k1 = static_cast<std::size_t>( boost::endian::endian_load<T, N, Order>( p + N ) );
+        std::size_t k2 = static_cast<std::size_t>( boost::endian::endian_load<T, N, Order>( p + 2 * N ) );
+        std::size_t k3 = static_cast<std::size_t>( boost::endian::endian_load<T, N, Order>( p + 3 * N ) );
+
+        if( k0 < nbins ) ++bins[ k0 ]; else ++r;
+        if( k1 < nbins ) ++bins[ k1 ]; else ++r;
+        if( k2 < nbins ) ++bins[ k2 ]; else ++r;
+        if( k3 < nbins ) ++bins[ k3 ]; else ++r;
+    }
+
+    for( ; i < n; ++i, p += N )
+    {
+        std::size_t k = static_cast<std::size_t>( boost::endian::endian_load<T, N, Order>( p ) );
+        if( k < nbins ) ++bins[ k ]; else ++r;
+    }
+
+    return r;
+}
+
+template<order Order, class T, std::size_t n_bits, align A, class C>
+inline std::size_t endian_histogram( C * bins, std::size_t nbins, endian_buffer<Order, T, n_bits, A> const * p, std::size_t n ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof( endian_buffer<Order, T, n_bits, A> ) == n_bits / 8 );
+    return boost::endian::endian_histogram<T, n_bits / 8, Order>( bins, nbins, reinterpret_cast<unsigned char const*>( p ), n );
+}
+
+// Requires:
+//
+//    T, N, Order as for endian_load
+//    p points to size consecutive N-byte counters
+//    index points to n indices; delta is either null or points to n values
+//
+// Effects: for each i, adds delta[ i ] (or 1 if delta is null) to the counter
+//          at index[ i ], if index[ i ] < size
+//
+// Returns: the number of updates that were skipped because index[ i ] >= size
+//
+// Runs of updates to the same counter are detected and applied with a single
+// load/reverse/add/reverse/store sequence.
+
+template<class T, std::size_t N, order Order, class I>
+inline std::size_t endian_counter_update( unsigned char * p, std::size_t size, I const * index, T const * delta, std::size_t n ) BOOST_NOEXCEPT
+{
+    std::size_t r = 0;
+
+    std::size_t i = 0;
+
+    while( i < n )
+    {
+        std::size_t k = static_cast<std::size_t>( index[ i ] );
+
+        T d = delta? delta[ i ]: static_cast<T>( 1 );
+
+        std::size_t j = i + 1;
+
+        for( ; j < n && static_cast<std::size_t>( index[ j ] ) == k; ++j )
+        {
+            d = static_cast<T>( d + ( delta? delta[ j ]: static_cast<T>( 1 ) ) );
+        }
+
+        if( k < size )
+        {
+            unsigned char * q = p + k * N;
+            boost::endian::endian_store<T, N, Order>( q, static_cast<T>( boost::endian::endian_load<T, N, Order>( q ) + d ) );
+        }
+        else
+        {
+            r += j - i;
+        }
+
+        i = j;
+    }
+
+    return r;
+}
+
+template<order Order, class T, std::size_t n_bits, align A, class I>
+inline std::size_t endian_counter_update( endian_buffer<Order, T, n_bits, A> * p, std::size_t size, I const * index, T const * delta, std::size_t n ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof( endian_buffer<Order, T, n_bits, A> ) == n_bits / 8 );
+    return boost::endian::endian_counter_update<T, n_bits / 8, Order>( reinterpret_cast<unsigned char*>( p ), size, index, delta, n );
+}
+
+template<order Order, class T, std::size_t n_bits, align A, class I>
+inline std::size_t endian_counter_update( endian_arithmetic<Order, T, n_bits, A> * p, std::size_t size, I const * index, T const * delta, std::size_t n ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof( endian_arithmetic<Order, T, n_bits, A> ) == n_bits / 8 );
+    return boost::endian::endian_counter_update<T, n_bits / 8, Order>( reinterpret_cast<unsigned char*>( p ), size, index, delta, n );
+}
+
+// increment by one
+
+template<order Order, class T, std::size_t n_bits, align A, class I>
+inline std::size_t endian_counter_update( endian_buffer<Order, T, n_bits, A> * p, std::size_t size, I const * index, std::size_t n ) BOOST_NOEXCEPT
+{
+    return boost::endian::endian_counter_update( p, size, index, static_cast<T const*>( 0 ), n );
+}
+
+template<order Order, class T, std::size_t n_bits, align A, class I>
+inline std::size_t endian_counter_update( endian_arithmetic<Order, T, n_bits, A> * p, std::size_t size, I const * index, std::size_t n ) BOOST_NOEXCEPT
+{
+    return boost::endian::endian_counter_update( p, size, index, static_cast<T const*>( 0 ), n );
+}
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_HISTOGRAM_HPP_INCLUDED
@@ -0,0 +1,195 @@
+#ifndef BOOST_ENDIAN_INET_CHECKSUM_HPP_INCLUDED
+#define BOOST_ENDIAN_INET_CHECKSUM_HPP_INCLUDED
+
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// The Internet checksum (RFC 1071) and its incremental update (RFC 1624).
+//
+// The ones' complement sum does not depend on the byte order in which it is
+// computed (RFC 1071, 2.B), so the data is summed as native 32-bit words,
+// without conversion, and only the final 16-bit result is converted to the
+// big endian value of the checksum field.
+//
+// All 16-bit values here, sums, checksums and field values alike, are the
+// values of the corresponding big endian fields, as returned by
+// big_uint16_buf_t::value().
+
+#include <boost/endian/conversion.hpp>
+#include <boost/endian/buffers.hpp>
+#include <boost/endian/arithmetic.hpp>
+#include <boost/endian/detail/endian_load.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace endian
+{
+
+namespace detail
+{
+
+inline std::uint16_t inet_fold( std::uint64_t s ) BOOST_NOEXCEPT
+{
+    s = ( s & 0xFFFFFFFFu ) + ( s >> 32 );
+    s = ( s & 0xFFFFFFFFu ) + ( s >> 32 );
+    s = ( s & 0xFFFFu ) + ( s >> 16 );
+    s = ( s & 0xFFFFu ) + ( s >> 16 );
+
+    return static_cast<std::uint16_t>( s );
+}
+
+inline std::uint16_t inet_add( std::uint16_t a, std::uint16_t b ) BOOST_NOEXCEPT
+{
+    return inet_fold( static_cast<std::uint64_t>( a ) + b );
+}
+
+} // namespace detail
+
+// Returns: the ones' complement sum of the 16-bit big endian words in
+// [ p, p + n ), an odd last byte being padded with a zero, added to sum
+//
+// A message can be summed in pieces by passing the result of one call as
+// the sum of the next, as long as every piece but the last has even length
+
+inline std::uint16_t inet_sum( unsigned char const * p, std::size_t n, std::uint16_t sum = 0 ) BOOST_NOEXCEPT
+{
+    // four independent 64-bit accumulators of 32-bit words, which the
+    // compiler can vectorize; they cannot overflow below 2^34 words each
+
+    std::uint64_t s0 = boost::endian::native_to_big( sum ), s1 = 0, s2 = 0, s3 = 0;
+
+    for( ; n >= 16; p += 16, n -= 16 )
+    {
+        s0 += boost::endian::endian_load<std::uint32_t, 4, order::native>( p +  0 );
+        s1 += boost::endian::endian_load<std::uint32_t, 4, order::native>( p +  4 );
+        s2 += boost::endian::endian_load<std::uint32_t, 4, order::native>( p +  8 );
+        s3 += boost::endian::endian_load<std::uint32_t, 4, order::native>( p + 12 );
+    }
+
+    if( n > 0 )
+    {
+        unsigned char tmp[ 16 ] = {};
+
+        for( std::size_t i = 0; i < n; ++i ) tmp[ i ] = p[ i ];
+
+        s0 += boost::endian::endian_load<std::uint32_t, 4, order::native>( tmp +  0 );
+        s1 += boost::endian::endian_load<std::uint32_t, 4, order::native>( tmp +  4 );
+        s2 += boost::endian::endian_load<std::uint32_t, 4, order::native>( tmp +  8 );
+        s3 += boost::endian::endian_load<std::uint32_t, 4, order::native>( tmp + 12 );
+    }
+
+    std::uint16_t r = detail::inet_add( detail::inet_fold( s0 + s1 ), detail::inet_fold( s2 + s3 ) );
+
+    return boost::endian::big_to_native( r );
+}
+
+// Returns: the Internet checksum of [ p, p + n ), the complement of inet_sum
+//
+// Computing it over data that contains its own correct checksum gives 0
+
+inline std::uint16_t inet_checksum( unsigned char const * p, std::size_t n, std::uint16_t sum = 0 ) BOOST_NOEXCEPT
+{
+    return static_cast<std::uint16_t>( ~inet_sum( p, n, sum ) );
+}
+
+// Returns: the checksum after a 16-bit word covered by it changes from
+// old_value to new_value, as in RFC 1624, eqn. 3: HC' = ~( ~HC + ~m + m' )
+
+inline std::uint16_t inet_checksum_update16( std::uint16_t checksum, std::uint16_t old_value, std::uint16_t new_value ) BOOST_NOEXCEPT
+{
+    std::uint64_t s = static_cast<std::uint16_t>( ~checksum );
+
+    s += static_cast<std::uint16_t>( ~old_value );
+    s += new_value;
+
+    return static_cast<std::uint16_t>( ~detail::inet_fold( s ) );
+}
+
+// Requires: the 32-bit field starts at an even offset within the data
+// covered by the checksum
+
+inline std::uint16_t inet_checksum_update32( std::uint16_t checksum, std::uint32_t old_value, std::uint32_t new_value ) BOOST_NOEXCEPT
+{
+    std::uint64_t s = static_cast<std::uint16_t>( ~checksum );
+
+    s += ~old_value;
+    s += new_value;
+
+    return static_cast<std::uint16_t>( ~detail::inet_fold( s ) );
+}
+
+// An assignment proxy for a big endian 16 or 32-bit field covered by a
+// checksum, such as an address or a port in a NAT rewriting path:
+//
+//    with_checksum( ip->destination, ip->checksum ) = new_address;
+//
+// Assigning through it stores the value and updates the checksum in O(1).
+// The field must start at an even offset within the checksummed data.
+
+template<class Field, class Checksum> class inet_checksum_proxy
+{
+private:
+
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof( Field ) == 2 || sizeof( Field ) == 4 );
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof( Checksum ) == 2 );
+
+    Field & field_;
+    Checksum & checksum_;
+
+public:
+
+    typedef typename Field::value_type value_type;
+
+    inet_checksum_proxy( Field & field, Checksum & checksum ) BOOST_NOEXCEPT: field_( field ), checksum_( checksum )
+    {
+    }
+
+    inet_checksum_proxy& operator=( value_type v ) BOOST_NOEXCEPT
+    {
+        std::uint32_t const old_value = static_cast<std::uint32_t>( field_.value() );
+        std::uint32_t const new_value = static_cast<std::uint32_t>( v );
+
+        std::uint16_t const c = static_cast<std::uint16_t>( checksum_.value() );
+
+        if( sizeof( Field ) == 2 )
+        {
+            checksum_ = inet_checksum_update16( c, static_cast<std::uint16_t>( old_value ), static_cast<std::uint16_t>( new_value ) );
+        }
+        else
+        {
+            checksum_ = inet_checksum_update32( c, old_value, new_value );
+        }
+
+        field_ = v;
+        return *this;
+    }
+
+    operator value_type() const BOOST_NOEXCEPT
+    {
+        return field_.value();
+    }
+};
+
+template<class T, std::size_t n_bits, align A, class Checksum>
+inline inet_checksum_proxy<endian_buffer<order::big, T, n_bits, A>, Checksum>
+    with_checksum( endian_buffer<order::big, T, n_bits, A> & field, Checksum & checksum ) BOOST_NOEXCEPT
+{
+    return inet_checksum_proxy<endian_buffer<order::big, T, n_bits, A>, Checksum>( field, checksum );
+}
+
+template<class T, std::size_t n_bits, align A, class Checksum>
+inline inet_checksum_proxy<endian_arithmetic<order::big, T, n_bits, A>, Checksum>
+    with_checksum( endian_arithmetic<order::big, T, n_bits, A> & field, Checksum & checksum ) BOOST_NOEXCEPT
+{
+    return inet_checksum_proxy<endian_arithmetic<order::big, T, n_bits, A>, Checksum>( field, checksum );
+}
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_INET_CHECKSUM_HPP_INCLUDED
@@ -0,0 +1,881 @@
+#ifndef BOOST_ENDIAN_MSGPACK_HPP_INCLUDED
+#define BOOST_ENDIAN_MSGPACK_HPP_INCLUDED
+
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// A MessagePack encoder and decoder working on caller supplied buffers,
+// without allocating.
+//
+//    unsigned char buffer[ 256 ];
+//    msgpack_writer w( buffer, sizeof( buffer ) );
+//
+//    w.write_map_header( 2 );
+//    w.write_str( "id", 2 );     w.write_uint( 42 );
+//    w.write_str( "xs", 2 );     w.write_array( xs, 1000 );
+//
+//    msgpack_reader r( buffer, w.size() );
+//
+// Multi-byte numbers are big endian and are stored and loaded with
+// store_big_u16, load_big_u32 and their siblings, and with endian_store and
+// endian_load for floats.
+//
+// write_array and read_array move arrays of numbers in one call; an array
+// of float64 or float32 elements, encoded with a tag byte before each
+// value, is decoded by a loop that only checks the tags and loads the
+// values, without going through the general decoder for each element.
+//
+// A read of an item of another type returns false and leaves the reader
+// where it was. A truncated or malformed input, or a write that does not
+// fit, also clears ok(); as with the cursors, the error is sticky.
+
+#include <boost/endian/conversion.hpp>
+#include <boost/endian/detail/endian_load.hpp>
+#include <boost/endian/detail/endian_store.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/config.hpp>
+#include <type_traits>
+#include <limits>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+namespace boost
+{
+namespace endian
+{
+
+enum class msgpack_type
+{
+    nil,
+    boolean,
+    unsigned_integer,   // a non-negative integer
+    signed_integer,     // a negative integer
+    float32,
+    float64,
+    str,
+    bin,
+    array,
+    map,
+    ext,
+    invalid
+};
+
+// the header of an item
+
+struct msgpack_item
+{
+    msgpack_type type;
+
+    // boolean: 0 or 1; unsigned_integer: the value; signed_integer: the
+    // value as std::uint64_t; str, bin, ext: the size of the payload;
+    // array, map: the number of elements or pairs
+    std::uint64_t value;
+
+    // float32, float64: the value
+    double real;
+
+    // ext: the type
+    std::int8_t ext_type;
+
+    // the size of the header, payload excluded; 0 if it does not fit or is
+    // not valid MessagePack
+    std::size_t header_size;
+};
+
+namespace detail
+{
+
+inline msgpack_item msgpack_make_item( msgpack_type type, std::uint64_t value, std::size_t header_size ) BOOST_NOEXCEPT
+{
+    msgpack_item r = { type, value, 0, 0, header_size };
+    return r;
+}
+
+// Returns: the item whose header starts at p, with header_size 0 if the
+// header does not fit in n bytes
+
+inline msgpack_item msgpack_parse( unsigned char const * p, std::size_t n ) BOOST_NOEXCEPT
+{
+    msgpack_item const none = msgpack_make_item( msgpack_type::invalid, 0, 0 );
+
+    if( n == 0 ) return none;
+
+    unsigned const c = p[ 0 ];
+
+    if( c <= 0x7F ) return msgpack_make_item( msgpack_type::unsigned_integer, c, 1 );
+    if( c >= 0xE0 ) return msgpack_make_item( msgpack_type::signed_integer, static_cast<std::uint64_t>( static_cast<std::int64_t>( static_cast<std::int8_t>( c ) ) ), 1 );
+    if( c <= 0x8F ) return msgpack_make_item( msgpack_type::map, c & 0x0F, 1 );
+    if( c <= 0x9F ) return msgpack_make_item( msgpack_type::array, c & 0x0F, 1 );
+    if( c <= 0xBF ) return msgpack_make_item( msgpack_type::str, c & 0x1F, 1 );
+
+    // the size of the header of each tag from 0xC0 to 0xDF; 0 for 0xC1
+
+    static unsigned char const sizes[ 32 ] =
+    {
+        1, 0, 1, 1, 2, 3, 5, 3, 4, 6, 5, 9, 2, 3, 5, 9,
+        2, 3, 5, 9, 2, 2, 2, 2, 2, 2, 3, 5, 3, 5, 3, 5
+    };
+
+    std::size_t const k = sizes[ c - 0xC0 ];
+
+    if( k == 0 || n < k ) return none;
+
+    unsigned char const * q = p + 1;
+
+    switch( c )
+    {
+    case 0xC0: return msgpack_make_item( msgpack_type::nil, 0, 1 );
+    case 0xC2: return msgpack_make_item( msgpack_type::boolean, 0, 1 );
+    case 0xC3: return msgpack_make_item( msgpack_type::boolean, 1, 1 );
+
+    case 0xC4: return msgpack_make_item( msgpack_type::bin, q[ 0 ], k );
+    case 0xC5: return msgpack_make_item( msgpack_type::bin, boost::endian::load_big_u16( q ), k );
+    case 0xC6: return msgpack_make_item( msgpack_type::bin, boost::endian::load_big_u32( q ), k );
+
+    case 0xC7:
+    case 0xC8:
+    case 0xC9:
+        {
+            std::uint64_t const size = c == 0xC7? q[ 0 ]: c == 0xC8? boost::endian::load_big_u16( q ): boost::endian::load_big_u32( q );
+
+            msgpack_item r = msgpack_make_item( msgpack_type::ext, size, k );
+            r.ext_type = static_cast<std::int8_t>( p[ k - 1 ] );
+
+            return r;
+        }
+
+    case 0xCA:
+        {
+            msgpack_item r = msgpack_make_item( msgpack_type::float32, 0, k );
+            r.real = boost::endian::endian_load<float, 4, order::big>( q );
+
+            return r;
+        }
+
+    case 0xCB:
+        {
+            msgpack_item r = msgpack_make_item( msgpack_type::float64, 0, k );
+            r.real = boost::endian::endian_load<double, 8, order::big>( q );
+
+            return r;
+        }
+
+    case 0xCC: return msgpack_make_item( msgpack_type::unsigned_integer, q[ 0 ], k );
+    case 0xCD: return msgpack_make_item( msgpack_type::unsigned_integer, boost::endian::load_big_u16( q ), k );
+    case 0xCE: return msgpack_make_item( msgpack_type::unsigned_integer, boost::endian::load_big_u32( q ), k );
+    case 0xCF: return msgpack_make_item( msgpack_type::unsigned_integer, boost::endian::load_big_u64( q ), k );
+
+    case 0xD0:
+    case 0xD1:
+    case 0xD2:
+    case 0xD3:
+        {
+            std::int64_t const v = c == 0xD0? static_cast<std::int8_t>( q[ 0 ] ): c == 0xD1? boost::endian::load_big_s16( q ): c == 0xD2? boost::endian::load_big_s32( q ): boost::endian::load_big_s64( q );
+
+            return msgpack_make_item( v < 0? msgpack_type::signed_integer: msgpack_type::unsigned_integer, static_cast<std::uint64_t>( v ), k );
+        }
+
+    case 0xD4:
+    case 0xD5:
+    case 0xD6:
+    case 0xD7:
+    case 0xD8:
+        {
+            msgpack_item r = msgpack_make_item( msgpack_type::ext, std::uint64_t( 1 ) << ( c - 0xD4 ), k );
+            r.ext_type = static_cast<std::int8_t>( q[ 0 ] );
+
+            return r;
+        }
+
+    case 0xD9: return msgpack_make_item( msgpack_type::str, q[ 0 ], k );
+    case 0xDA: return msgpack_make_item( msgpack_type::str, boost::endian::load_big_u16( q ), k );
+    case 0xDB: return msgpack_make_item( msgpack_type::str, boost::endian::load_big_u32( q ), k );
+
+    case 0xDC: return msgpack_make_item( msgpack_type::array, boost::endian::load_big_u16( q ), k );
+    case 0xDD: return msgpack_make_item( msgpack_type::array, boost::endian::load_big_u32( q ), k );
+
+    case 0xDE: return msgpack_make_item( msgpack_type::map, boost::endian::load_big_u16( q ), k );
+    default:   return msgpack_make_item( msgpack_type::map, boost::endian::load_big_u32( q ), k );
+    }
+}
+
+} // namespace detail
+
+class msgpack_writer
+{
+private:
+
+    unsigned char * begin_;
+    unsigned char * p_;
+    unsigned char * end_;
+
+    bool ok_;
+
+    // Returns: where to write n bytes, or 0 if they do not fit
+
+    unsigned char * reserve( std::size_t n ) BOOST_NOEXCEPT
+    {
+        if( !ok_ || n > static_cast<std::size_t>( end_ - p_ ) )
+        {
+            ok_ = false;
+            return 0;
+        }
+
+        unsigned char * r = p_;
+        p_ += n;
+
+        return r;
+    }
+
+    // a header made of a tag of the form c8 c16 c32 followed by n, or of
+    // fix | n for n < fix_limit
+
+    bool write_header( std::uint64_t n, unsigned fix, std::uint64_t fix_limit, unsigned c8, unsigned c16, unsigned c32 ) BOOST_NOEXCEPT
+    {
+        if( n < fix_limit )
+        {
+            unsigned char * p = reserve( 1 );
+            if( p == 0 ) return false;
+
+            p[ 0 ] = static_cast<unsigned char>( fix | n );
+        }
+        else if( n <= 0xFF && c8 != 0 )
+        {
+            unsigned char * p = reserve( 2 );
+            if( p == 0 ) return false;
+
+            p[ 0 ] = static_cast<unsigned char>( c8 );
+            p[ 1 ] = static_cast<unsigned char>( n );
+        }
+        else if( n <= 0xFFFF )
+        {
+            unsigned char * p = reserve( 3 );
+            if( p == 0 ) return false;
+
+            p[ 0 ] = static_cast<unsigned char>( c16 );
+            boost::endian::store_big_u16( p + 1, static_cast<std::uint16_t>( n ) );
+        }
+        else if( n <= 0xFFFFFFFF )
+        {
+            unsigned char * p = reserve( 5 );
+            if( p == 0 ) return false;
+
+            p[ 0 ] = static_cast<unsigned char>( c32 );
+            boost::endian::store_big_u32( p + 1, static_cast<std::uint32_t>( n ) );
+        }
+        else
+        {
+            ok_ = false;
+            return false;
+        }
+
+        return true;
+    }
+
+    // str, bin: the header and the payload, or nothing if both do not fit
+
+    bool write_blob( void const * data, std::size_t n, unsigned fix, std::uint64_t fix_limit, unsigned c8, unsigned c16, unsigned c32 ) BOOST_NOEXCEPT
+    {
+        std::size_t const header = n < fix_limit? 1: n <= 0xFF && c8 != 0? 2: n <= 0xFFFF? 3: 5;
+
+        if( header > static_cast<std::size_t>( end_ - p_ ) || n > static_cast<std::size_t>( end_ - p_ ) - header )
+        {
+            ok_ = false;
+            return false;
+        }
+
+        if( !write_header( n, fix, fix_limit, c8, c16, c32 ) ) return false;
+
+        if( n != 0 ) std::memcpy( p_, data, n );
+        p_ += n;
+
+        return true;
+    }
+
+    template<class T> bool write_element( T v, std::true_type ) BOOST_NOEXCEPT
+    {
+        return std::is_signed<T>::value? write_int( static_cast<std::int64_t>( v ) ): write_uint( static_cast<std::uint64_t>( v ) );
+    }
+
+    template<class T> bool write_element( T v, std::false_type ) BOOST_NOEXCEPT
+    {
+        return write_float( v );
+    }
+
+public:
+
+    msgpack_writer( unsigned char * p, std::size_t size ) BOOST_NOEXCEPT: begin_( p ), p_( p ), end_( p + size ), ok_( true )
+    {
+    }
+
+    bool write_nil() BOOST_NOEXCEPT
+    {
+        unsigned char * p = reserve( 1 );
+        if( p == 0 ) return false;
+
+        p[ 0 ] = 0xC0;
+        return true;
+    }
+
+    bool write_bool( bool v ) BOOST_NOEXCEPT
+    {
+        unsigned char * p = reserve( 1 );
+        if( p == 0 ) return false;
+
+        p[ 0 ] = v? 0xC3: 0xC2;
+        return true;
+    }
+
+    // integers are written in the shortest form that holds them
+
+    bool write_uint( std::uint64_t v ) BOOST_NOEXCEPT
+    {
+        if( v <= 0x7F )
+        {
+            unsigned char * p = reserve( 1 );
+            if( p == 0 ) return false;
+
+            p[ 0 ] = static_cast<unsigned char>( v );
+        }
+        else if( v <= 0xFF )
+        {
+            unsigned char * p = reserve( 2 );
+            if( p == 0 ) return false;
+
+            p[ 0 ] = 0xCC;
+            p[ 1 ] = static_cast<unsigned char>( v );
+        }
+        else if( v <= 0xFFFF )
+        {
+            unsigned char * p = reserve( 3 );
+            if( p == 0 ) return false;
+
+            p[ 0 ] = 0xCD;
+            boost::endian::store_big_u16( p + 1, static_cast<std::uint16_t>( v ) );
+        }
+        else if( v <= 0xFFFFFFFF )
+        {
+            unsigned char * p = reserve( 5 );
+            if( p == 0 ) return false;
+
+            p[ 0 ] = 0xCE;
+            boost::endian::store_big_u32( p + 1, static_cast<std::uint32_t>( v ) );
+        }
+        else
+        {
+            unsigned char * p = reserve( 9 );
+            if( p == 0 ) return false;
+
+            p[ 0 ] = 0xCF;
+            boost::endian::store_big_u64( p + 1, v );
+        }
+
+        return true;
+    }
+
+    bool write_int( std::int64_t v ) BOOST_NOEXCEPT
+    {
+        if( v >= 0 ) return write_uint( static_cast<std::uint64_t>( v ) );
+
+        if( v >= -32 )
+        {
+            unsigned char * p = reserve( 1 );
+            if( p == 0 ) return false;
+
+            p[ 0 ] = static_cast<unsigned char>( v );
+        }
+        else if( v >= -128 )
+        {
+            unsigned char * p = reserve( 2 );
+            if( p == 0 ) return false;
+
+            p[ 0 ] = 0xD0;
+            p[ 1 ] = static_cast<unsigned char>( v );
+        }
+        else if( v >= -32768 )
+        {
+            unsigned char * p = reserve( 3 );
+            if( p == 0 ) return false;
+
+            p[ 0 ] = 0xD1;
+            boost::endian::store_big_s16( p + 1, static_cast<std::int16_t>( v ) );
+        }
+        else if( v >= -2147483647 - 1 )
+        {
+            unsigned char * p = reserve( 5 );
+            if( p == 0 ) return false;
+
+            p[ 0 ] = 0xD2;
+            boost::endian::store_big_s32( p + 1, static_cast<std::int32_t>( v ) );
+        }
+        else
+        {
+            unsigned char * p = reserve( 9 );
+            if( p == 0 ) return false;
+
+            p[ 0 ] = 0xD3;
+            boost::endian::store_big_s64( p + 1, v );
+        }
+
+        return true;
+    }
+
+    bool write_float( float v ) BOOST_NOEXCEPT
+    {
+        unsigned char * p = reserve( 5 );
+        if( p == 0 ) return false;
+
+        p[ 0 ] = 0xCA;
+        boost::endian::endian_store<float, 4, order::big>( p + 1, v );
+
+        return true;
+    }
+
+    bool write_float( double v ) BOOST_NOEXCEPT
+    {
+        unsigned char * p = reserve( 9 );
+        if( p == 0 ) return false;
+
+        p[ 0 ] = 0xCB;
+        boost::endian::endian_store<double, 8, order::big>( p + 1, v );
+
+        return true;
+    }
+
+    bool write_str( char const * s, std::size_t n ) BOOST_NOEXCEPT
+    {
+        return write_blob( s, n, 0xA0, 32, 0xD9, 0xDA, 0xDB );
+    }
+
+    bool write_bin( void const * data, std::size_t n ) BOOST_NOEXCEPT
+    {
+        return write_blob( data, n, 0, 0, 0xC4, 0xC5, 0xC6 );
+    }
+
+    // followed by n items
+
+    bool write_array_header( std::size_t n ) BOOST_NOEXCEPT
+    {
+        return write_header( n, 0x90, 16, 0, 0xDC, 0xDD );
+    }
+
+    // followed by n pairs of items
+
+    bool write_map_header( std::size_t n ) BOOST_NOEXCEPT
+    {
+        return write_header( n, 0x80, 16, 0, 0xDE, 0xDF );
+    }
+
+    // writes an array of the n numbers at v; float and double elements are
+    // written as float32 and float64, integers in their shortest form
+    // Returns: false, possibly after writing part of it, if it does not fit
+
+    template<class T> bool write_array( T const * v, std::size_t n ) BOOST_NOEXCEPT
+    {
+        BOOST_ENDIAN_STATIC_ASSERT( std::is_arithmetic<T>::value && !std::is_same<T, bool>::value );
+
+        if( !write_array_header( n ) ) return false;
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            if( !write_element( v[ i ], std::is_integral<T>() ) ) return false;
+        }
+
+        return true;
+    }
+
+    // the number of bytes written
+
+    std::size_t size() const BOOST_NOEXCEPT
+    {
+        return static_cast<std::size_t>( p_ - begin_ );
+    }
+
+    unsigned char const * data() const BOOST_NOEXCEPT
+    {
+        return begin_;
+    }
+
+    bool ok() const BOOST_NOEXCEPT
+    {
+        return ok_;
+    }
+};
+
+class msgpack_reader
+{
+private:
+
+    unsigned char const * begin_;
+    unsigned char const * p_;
+    unsigned char const * end_;
+
+    bool ok_;
+
+    std::size_t remaining() const BOOST_NOEXCEPT
+    {
+        return static_cast<std::size_t>( end_ - p_ );
+    }
+
+    // Returns: the header of the next item if it has the type t, or else
+    // an item with header_size 0, clearing ok() if the input is truncated
+
+    msgpack_item expect( msgpack_type t ) BOOST_NOEXCEPT
+    {
+        msgpack_item r = detail::msgpack_parse( p_, remaining() );
+
+        if( r.header_size == 0 )
+        {
+            ok_ = false;
+        }
+        else if( r.type != t )
+        {
+            r.header_size = 0;
+        }
+
+        return r;
+    }
+
+    // str, bin: the header and the payload
+
+    bool read_blob( msgpack_type t, unsigned char const * & data, std::size_t & n ) BOOST_NOEXCEPT
+    {
+        msgpack_item const it = expect( t );
+
+        if( it.header_size == 0 ) return false;
+
+        if( it.value > remaining() - it.header_size )
+        {
+            ok_ = false;
+            return false;
+        }
+
+        data = p_ + it.header_size;
+        n = static_cast<std::size_t>( it.value );
+
+        p_ += it.header_size + n;
+
+        return true;
+    }
+
+    template<class T> bool read_element( T & v, std::true_type ) BOOST_NOEXCEPT
+    {
+        return read_int( v );
+    }
+
+    template<class T> bool read_element( T & v, std::false_type ) BOOST_NOEXCEPT
+    {
+        return read_float( v );
+    }
+
+    // the elements of an array of float64 or float32 items: each one is a
+    // tag byte followed by the value
+
+    template<class T, class F, std::size_t N> bool read_reals( T * dst, std::size_t n, unsigned tag ) BOOST_NOEXCEPT
+    {
+        if( n > remaining() / ( N + 1 ) ) return false;
+
+        unsigned char const * p = p_;
+
+        for( std::size_t i = 0; i < n; ++i, p += N + 1 )
+        {
+            if( p[ 0 ] != tag ) return false;
+        }
+
+        p = p_;
+
+        for( std::size_t i = 0; i < n; ++i, p += N + 1 )
+        {
+            dst[ i ] = static_cast<T>( boost::endian::endian_load<F, N, order::big>( p + 1 ) );
+        }
+
+        p_ = p;
+
+        return true;
+    }
+
+    template<class T> bool read_homogeneous( T * dst, std::size_t n, std::true_type ) BOOST_NOEXCEPT
+    {
+        (void)dst; (void)n;
+        return false;
+    }
+
+    template<class T> bool read_homogeneous( T * dst, std::size_t n, std::false_type ) BOOST_NOEXCEPT
+    {
+        if( n == 0 || remaining() == 0 ) return false;
+
+        if( p_[ 0 ] == 0xCB ) return read_reals<T, double, 8>( dst, n, 0xCB );
+        if( p_[ 0 ] == 0xCA ) return read_reals<T, float, 4>( dst, n, 0xCA );
+
+        return false;
+    }
+
+public:
+
+    msgpack_reader( unsigned char const * p, std::size_t size ) BOOST_NOEXCEPT: begin_( p ), p_( p ), end_( p + size ), ok_( true )
+    {
+    }
+
+    // Returns: the header of the next item, without moving past it
+
+    msgpack_item peek() const BOOST_NOEXCEPT
+    {
+        return detail::msgpack_parse( p_, remaining() );
+    }
+
+    msgpack_type next_type() const BOOST_NOEXCEPT
+    {
+        msgpack_item const it = peek();
+        return it.header_size == 0? msgpack_type::invalid: it.type;
+    }
+
+    bool read_nil() BOOST_NOEXCEPT
+    {
+        msgpack_item const it = expect( msgpack_type::nil );
+
+        p_ += it.header_size;
+        return it.header_size != 0;
+    }
+
+    bool read_bool( bool & v ) BOOST_NOEXCEPT
+    {
+        msgpack_item const it = expect( msgpack_type::boolean );
+
+        if( it.header_size == 0 ) return false;
+
+        v = it.value != 0;
+        p_ += it.header_size;
+
+        return true;
+    }
+
+    // reads an integer of any format
+    // Returns: false, reading nothing, if it is not an integer or if T
+    // cannot hold its value
+
+    template<class T> bool read_int( T & v ) BOOST_NOEXCEPT
+    {
+        BOOST_ENDIAN_STATIC_ASSERT( std::is_integral<T>::value && !std::is_same<T, bool>::value );
+
+        msgpack_item const it = peek();
+
+        if( it.header_size == 0 )
+        {
+            ok_ = false;
+            return false;
+        }
+
+        if( it.type == msgpack_type::unsigned_integer )
+        {
+            std::uint64_t const max = static_cast<std::uint64_t>( std::numeric_limits<T>::max() );
+            if( it.value > max ) return false;
+        }
+        else if( it.type == msgpack_type::signed_integer )
+        {
+            std::int64_t const min = static_cast<std::int64_t>( std::numeric_limits<T>::min() );
+            if( !std::is_signed<T>::value || static_cast<std::int64_t>( it.value ) < min ) return false;
+        }
+        else
+        {
+            return false;
+        }
+
+        v = static_cast<T>( it.value );
+        p_ += it.header_size;
+
+        return true;
+    }
+
+    // reads a float32 or a float64
+
+    template<class T> bool read_float( T & v ) BOOST_NOEXCEPT
+    {
+        BOOST_ENDIAN_STATIC_ASSERT( std::is_floating_point<T>::value );
+
+        msgpack_item const it = peek();
+
+        if( it.header_size == 0 )
+        {
+            ok_ = false;
+            return false;
+        }
+
+        if( it.type != msgpack_type::float32 && it.type != msgpack_type::float64 ) return false;
+
+        v = static_cast<T>( it.real );
+        p_ += it.header_size;
+
+        return true;
+    }
+
+    // the string is not copied: data points into the input
+
+    bool read_str( char const * & data, std::size_t & n ) BOOST_NOEXCEPT
+    {
+        unsigned char const * p;
+
+        if( !read_blob( msgpack_type::str, p, n ) ) return false;
+
+        data = reinterpret_cast<char const*>( p );
+        return true;
+    }
+
+    bool read_bin( unsigned char const * & data, std::size_t & n ) BOOST_NOEXCEPT
+    {
+        return read_blob( msgpack_type::bin, data, n );
+    }
+
+    bool read_array_header( std::size_t & n ) BOOST_NOEXCEPT
+    {
+        msgpack_item const it = expect( msgpack_type::array );
+
+        if( it.header_size == 0 ) return false;
+
+        n = static_cast<std::size_t>( it.value );
+        p_ += it.header_size;
+
+        return true;
+    }
+
+    bool read_map_header( std::size_t & n ) BOOST_NOEXCEPT
+    {
+        msgpack_item const it = expect( msgpack_type::map );
+
+        if( it.header_size == 0 ) return false;
+
+        n = static_cast<std::size_t>( it.value );
+        p_ += it.header_size;
+
+        return true;
+    }
+
+    // reads an array of at most capacity numbers into dst, setting n to the
+    // number of elements; the elements are read as by read_int or read_float
+    // Returns: false, reading nothing, if the next item is not such an array
+
+    template<class T> bool read_array( T * dst, std::size_t capacity, std::size_t & n ) BOOST_NOEXCEPT
+    {
+        BOOST_ENDIAN_STATIC_ASSERT( std::is_arithmetic<T>::value && !std::is_same<T, bool>::value );
+
+        unsigned char const * const start = p_;
+
+        std::size_t m;
+
+        if( !read_array_header( m ) ) return false;
+
+        if( m <= capacity )
+        {
+            if( read_homogeneous( dst, m, std::is_integral<T>() ) )
+            {
+                n = m;
+                return true;
+            }
+
+            std::size_t i = 0;
+
+            for( ; i < m; ++i )
+            {
+                if( !read_element( dst[ i ], std::is_integral<T>() ) ) break;
+            }
+
+            if( i == m )
+            {
+                n = m;
+                return true;
+            }
+        }
+
+        p_ = start;
+        return false;
+    }
+
+    // moves past the next item, including the elements of an array or a map
+    // Returns: false, clearing ok(), if the input is truncated or malformed
+
+    bool skip() BOOST_NOEXCEPT
+    {
+        unsigned char const * p = p_;
+
+        // the number of items still to skip
+        std::uint64_t pending = 1;
+
+        while( pending != 0 )
+        {
+            // each pending item takes at least one byte
+            if( pending > static_cast<std::size_t>( end_ - p ) )
+            {
+                ok_ = false;
+                return false;
+            }
+
+            msgpack_item const it = detail::msgpack_parse( p, static_cast<std::size_t>( end_ - p ) );
+
+            if( it.header_size == 0 )
+            {
+                ok_ = false;
+                return false;
+            }
+
+            p += it.header_size;
+            --pending;
+
+            switch( it.type )
+            {
+            case msgpack_type::str:
+            case msgpack_type::bin:
+            case msgpack_type::ext:
+
+                if( it.value > static_cast<std::size_t>( end_ - p ) )
+                {
+                    ok_ = false;
+                    return false;
+                }
+
+                p += static_cast<std::size_t>( it.value );
+                break;
+
+            case msgpack_type::array:
+
+                pending += it.value;
+                break;
+
+            case msgpack_type::map:
+
+                pending += 2 * it.value;
+                break;
+
+            default:
+
+                break;
+            }
+        }
+
+        p_ = p;
+        return true;
+    }
+
+    // the number of bytes read
+
+    std::size_t tell() const BOOST_NOEXCEPT
+    {
+        return static_cast<std::size_t>( p_ - begin_ );
+    }
+
+    bool empty() const BOOST_NOEXCEPT
+    {
+        return p_ == end_;
+    }
+
+    bool ok() const BOOST_NOEXCEPT
+    {
+        return ok_;
+    }
+};
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_MSGPACK_HPP_INCLUDED
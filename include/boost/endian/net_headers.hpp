@@ -0,0 +1,528 @@
+#ifndef BOOST_ENDIAN_NET_HEADERS_HPP_INCLUDED
+#define BOOST_ENDIAN_NET_HEADERS_HPP_INCLUDED
+
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Ethernet, VLAN, IPv4, IPv6, TCP, UDP and ICMP headers made of unaligned
+// big endian buffers, so that they can be overlaid on packet data at any
+// address. The layouts are checked against the wire formats below, so
+// offsetof() on them gives the protocol offsets as constant expressions.
+//
+// header_view<H> checks that a byte range is large enough for the header,
+// including its options, before giving access to it. parse_packet follows
+// the chain of headers of an Ethernet frame, and parse_packets does so for a
+// burst of frames, prefetching the frames ahead of the one being parsed.
+
+#include <boost/endian/buffers.hpp>
+#include <boost/endian/bitfield.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/config.hpp>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+#if !defined(__GNUC__) && defined(_MSC_VER) && ( defined(_M_X64) || defined(_M_IX86) )
+# include <xmmintrin.h>
+#endif
+
+namespace boost
+{
+namespace endian
+{
+
+// ether types and IP protocol numbers used by parse_packet
+
+BOOST_CONSTEXPR_OR_CONST std::uint16_t ether_type_ipv4 = 0x0800;
+BOOST_CONSTEXPR_OR_CONST std::uint16_t ether_type_vlan = 0x8100;
+BOOST_CONSTEXPR_OR_CONST std::uint16_t ether_type_ipv6 = 0x86DD;
+BOOST_CONSTEXPR_OR_CONST std::uint16_t ether_type_qinq = 0x88A8;
+
+BOOST_CONSTEXPR_OR_CONST std::uint8_t ip_protocol_icmp = 1;
+BOOST_CONSTEXPR_OR_CONST std::uint8_t ip_protocol_tcp = 6;
+BOOST_CONSTEXPR_OR_CONST std::uint8_t ip_protocol_udp = 17;
+BOOST_CONSTEXPR_OR_CONST std::uint8_t ip_protocol_icmpv6 = 58;
+
+// Each header H has a constant min_size and a member function header_size(),
+// which returns the size of the header including any options, or 0 if the
+// header is malformed.
+
+struct ethernet_header
+{
+    static BOOST_CONSTEXPR_OR_CONST std::size_t min_size = 14;
+
+    unsigned char destination[ 6 ];
+    unsigned char source[ 6 ];
+    big_uint16_buf_t ether_type;
+
+    std::size_t header_size() const BOOST_NOEXCEPT
+    {
+        return min_size;
+    }
+};
+
+struct vlan_tag
+{
+    static BOOST_CONSTEXPR_OR_CONST std::size_t min_size = 4;
+
+    big_uint16_buf_t tci;
+    big_uint16_buf_t ether_type;
+
+    std::size_t header_size() const BOOST_NOEXCEPT
+    {
+        return min_size;
+    }
+
+    std::uint16_t priority() const BOOST_NOEXCEPT
+    {
+        return endian_bitfield<order::big, std::uint16_t, 13, 3>::get( tci );
+    }
+
+    std::uint16_t vlan_id() const BOOST_NOEXCEPT
+    {
+        return endian_bitfield<order::big, std::uint16_t, 0, 12>::get( tci );
+    }
+};
+
+struct ipv4_header
+{
+    static BOOST_CONSTEXPR_OR_CONST std::size_t min_size = 20;
+
+    big_uint8_buf_t version_ihl;
+    big_uint8_buf_t tos;
+    big_uint16_buf_t total_length;
+    big_uint16_buf_t identification;
+    big_uint16_buf_t flags_fragment_offset;
+    big_uint8_buf_t ttl;
+    big_uint8_buf_t protocol;
+    big_uint16_buf_t checksum;
+    big_uint32_buf_t source;
+    big_uint32_buf_t destination;
+
+    std::uint8_t version() const BOOST_NOEXCEPT
+    {
+        return endian_bitfield<order::big, std::uint8_t, 4, 4>::get( version_ihl );
+    }
+
+    std::uint8_t ihl() const BOOST_NOEXCEPT
+    {
+        return endian_bitfield<order::big, std::uint8_t, 0, 4>::get( version_ihl );
+    }
+
+    std::uint16_t flags() const BOOST_NOEXCEPT
+    {
+        return endian_bitfield<order::big, std::uint16_t, 13, 3>::get( flags_fragment_offset );
+    }
+
+    std::uint16_t fragment_offset() const BOOST_NOEXCEPT
+    {
+        return endian_bitfield<order::big, std::uint16_t, 0, 13>::get( flags_fragment_offset );
+    }
+
+    std::size_t header_size() const BOOST_NOEXCEPT
+    {
+        return version() == 4? ihl() * 4u: 0;
+    }
+};
+
+struct ipv6_header
+{
+    static BOOST_CONSTEXPR_OR_CONST std::size_t min_size = 40;
+
+    big_uint32_buf_t version_class_flow;
+    big_uint16_buf_t payload_length;
+    big_uint8_buf_t next_header;
+    big_uint8_buf_t hop_limit;
+    unsigned char source[ 16 ];
+    unsigned char destination[ 16 ];
+
+    std::uint32_t version() const BOOST_NOEXCEPT
+    {
+        return endian_bitfield<order::big, std::uint32_t, 28, 4>::get( version_class_flow );
+    }
+
+    std::uint32_t traffic_class() const BOOST_NOEXCEPT
+    {
+        return endian_bitfield<order::big, std::uint32_t, 20, 8>::get( version_class_flow );
+    }
+
+    std::uint32_t flow_label() const BOOST_NOEXCEPT
+    {
+        return endian_bitfield<order::big, std::uint32_t, 0, 20>::get( version_class_flow );
+    }
+
+    std::size_t header_size() const BOOST_NOEXCEPT
+    {
+        return version() == 6? min_size: 0;
+    }
+};
+
+struct tcp_header
+{
+    static BOOST_CONSTEXPR_OR_CONST std::size_t min_size = 20;
+
+    big_uint16_buf_t source_port;
+    big_uint16_buf_t destination_port;
+    big_uint32_buf_t sequence_number;
+    big_uint32_buf_t acknowledgment_number;
+    big_uint16_buf_t offset_flags;
+    big_uint16_buf_t window;
+    big_uint16_buf_t checksum;
+    big_uint16_buf_t urgent_pointer;
+
+    std::uint16_t data_offset() const BOOST_NOEXCEPT
+    {
+        return endian_bitfield<order::big, std::uint16_t, 12, 4>::get( offset_flags );
+    }
+
+    std::uint16_t flags() const BOOST_NOEXCEPT
+    {
+        return endian_bitfield<order::big, std::uint16_t, 0, 9>::get( offset_flags );
+    }
+
+    std::size_t header_size() const BOOST_NOEXCEPT
+    {
+        return data_offset() * 4u;
+    }
+};
+
+struct udp_header
+{
+    static BOOST_CONSTEXPR_OR_CONST std::size_t min_size = 8;
+
+    big_uint16_buf_t source_port;
+    big_uint16_buf_t destination_port;
+    big_uint16_buf_t length;
+    big_uint16_buf_t checksum;
+
+    std::size_t header_size() const BOOST_NOEXCEPT
+    {
+        return min_size;
+    }
+};
+
+struct icmp_header
+{
+    static BOOST_CONSTEXPR_OR_CONST std::size_t min_size = 8;
+
+    big_uint8_buf_t type;
+    big_uint8_buf_t code;
+    big_uint16_buf_t checksum;
+    big_uint32_buf_t rest;
+
+    std::size_t header_size() const BOOST_NOEXCEPT
+    {
+        return min_size;
+    }
+};
+
+#define BOOST_ENDIAN_NET_HEADER_LAYOUT( H, M, offset ) BOOST_ENDIAN_STATIC_ASSERT( offsetof( H, M ) == offset )
+
+BOOST_ENDIAN_STATIC_ASSERT( sizeof( ethernet_header ) == ethernet_header::min_size );
+BOOST_ENDIAN_NET_HEADER_LAYOUT( ethernet_header, ether_type, 12 );
+
+BOOST_ENDIAN_STATIC_ASSERT( sizeof( vlan_tag ) == vlan_tag::min_size );
+BOOST_ENDIAN_NET_HEADER_LAYOUT( vlan_tag, ether_type, 2 );
+
+BOOST_ENDIAN_STATIC_ASSERT( sizeof( ipv4_header ) == ipv4_header::min_size );
+BOOST_ENDIAN_NET_HEADER_LAYOUT( ipv4_header, total_length, 2 );
+BOOST_ENDIAN_NET_HEADER_LAYOUT( ipv4_header, ttl, 8 );
+BOOST_ENDIAN_NET_HEADER_LAYOUT( ipv4_header, checksum, 10 );
+BOOST_ENDIAN_NET_HEADER_LAYOUT( ipv4_header, destination, 16 );
+
+BOOST_ENDIAN_STATIC_ASSERT( sizeof( ipv6_header ) == ipv6_header::min_size );
+BOOST_ENDIAN_NET_HEADER_LAYOUT( ipv6_header, next_header, 6 );
+BOOST_ENDIAN_NET_HEADER_LAYOUT( ipv6_header, destination, 24 );
+
+BOOST_ENDIAN_STATIC_ASSERT( sizeof( tcp_header ) == tcp_header::min_size );
+BOOST_ENDIAN_NET_HEADER_LAYOUT( tcp_header, offset_flags, 12 );
+BOOST_ENDIAN_NET_HEADER_LAYOUT( tcp_header, checksum, 16 );
+
+BOOST_ENDIAN_STATIC_ASSERT( sizeof( udp_header ) == udp_header::min_size );
+BOOST_ENDIAN_NET_HEADER_LAYOUT( udp_header, checksum, 6 );
+
+BOOST_ENDIAN_STATIC_ASSERT( sizeof( icmp_header ) == icmp_header::min_size );
+BOOST_ENDIAN_NET_HEADER_LAYOUT( icmp_header, checksum, 2 );
+
+#undef BOOST_ENDIAN_NET_HEADER_LAYOUT
+
+// A bounds checked view of the header H at the start of [ p, p + size ).
+// Byte is unsigned char const for read-only access and unsigned char for
+// rewriting headers in place.
+
+template<class H, class Byte = unsigned char const> class header_view
+{
+public:
+
+    typedef typename std::conditional<std::is_const<Byte>::value, H const, H>::type header_type;
+
+private:
+
+    Byte * p_;
+    std::size_t header_size_;
+    std::size_t size_;
+
+public:
+
+    header_view() BOOST_NOEXCEPT: p_( 0 ), header_size_( 0 ), size_( 0 )
+    {
+    }
+
+    // Postconditions: valid() if size is at least min_size and the size of
+    // the header, including options, is well-formed and at most size
+
+    header_view( Byte * p, std::size_t size ) BOOST_NOEXCEPT: p_( 0 ), header_size_( 0 ), size_( 0 )
+    {
+        if( size >= H::min_size )
+        {
+            std::size_t k = reinterpret_cast<H const *>( p )->header_size();
+
+            if( k >= H::min_size && k <= size )
+            {
+                p_ = p;
+                header_size_ = k;
+                size_ = size;
+            }
+        }
+    }
+
+    bool valid() const BOOST_NOEXCEPT
+    {
+        return p_ != 0;
+    }
+
+    // Requires: valid()
+
+    header_type * operator->() const BOOST_NOEXCEPT
+    {
+        return reinterpret_cast<header_type *>( p_ );
+    }
+
+    header_type & operator*() const BOOST_NOEXCEPT
+    {
+        return *reinterpret_cast<header_type *>( p_ );
+    }
+
+    Byte * data() const BOOST_NOEXCEPT
+    {
+        return p_;
+    }
+
+    std::size_t header_size() const BOOST_NOEXCEPT
+    {
+        return header_size_;
+    }
+
+    // the bytes following the header
+
+    Byte * payload() const BOOST_NOEXCEPT
+    {
+        return p_ + header_size_;
+    }
+
+    std::size_t payload_size() const BOOST_NOEXCEPT
+    {
+        return size_ - header_size_;
+    }
+};
+
+// the headers of an Ethernet frame; absent or unrecognized headers are null
+
+struct parsed_packet
+{
+    ethernet_header const * ethernet;
+
+    // the innermost VLAN tag, for tagged and double tagged frames
+    vlan_tag const * vlan;
+
+    ipv4_header const * ipv4;
+    ipv6_header const * ipv6;
+
+    tcp_header const * tcp;
+    udp_header const * udp;
+    icmp_header const * icmp;
+
+    // the innermost header that was recognized is followed by payload_size
+    // bytes at payload; IP padding at the end of the frame is excluded
+    unsigned char const * payload;
+    std::size_t payload_size;
+};
+
+namespace detail
+{
+
+inline void prefetch( void const * p ) BOOST_NOEXCEPT
+{
+#if defined(__GNUC__)
+
+    __builtin_prefetch( p );
+
+#elif defined(_MSC_VER) && ( defined(_M_X64) || defined(_M_IX86) )
+
+    _mm_prefetch( static_cast<char const *>( p ), _MM_HINT_T0 );
+
+#else
+
+    (void)p;
+
+#endif
+}
+
+template<class H> inline bool parse_next( H const * & h, unsigned char const * & p, std::size_t & n ) BOOST_NOEXCEPT
+{
+    header_view<H> v( p, n );
+
+    if( !v.valid() ) return false;
+
+    h = v.operator->();
+
+    p = v.payload();
+    n = v.payload_size();
+
+    return true;
+}
+
+} // namespace detail
+
+// Effects: parses Ethernet, up to two VLAN tags, IPv4 or IPv6, and TCP, UDP
+// or ICMP. IPv6 extension headers and non-initial IPv4 fragments end the
+// chain at the IP header.
+//
+// Returns: false if a recognized header is truncated or malformed; the
+// headers parsed before it are still set
+
+inline bool parse_packet( parsed_packet & r, unsigned char const * p, std::size_t n ) BOOST_NOEXCEPT
+{
+    r.ethernet = 0;
+    r.vlan = 0;
+    r.ipv4 = 0;
+    r.ipv6 = 0;
+    r.tcp = 0;
+    r.udp = 0;
+    r.icmp = 0;
+    r.payload = p;
+    r.payload_size = n;
+
+    if( !detail::parse_next( r.ethernet, p, n ) ) return false;
+
+    std::uint16_t type = r.ethernet->ether_type.value();
+
+    for( int i = 0; i < 2 && ( type == ether_type_vlan || type == ether_type_qinq ); ++i )
+    {
+        r.payload = p;
+        r.payload_size = n;
+
+        if( !detail::parse_next( r.vlan, p, n ) ) return false;
+
+        type = r.vlan->ether_type.value();
+    }
+
+    r.payload = p;
+    r.payload_size = n;
+
+    std::uint8_t protocol = 0;
+
+    if( type == ether_type_ipv4 )
+    {
+        if( !detail::parse_next( r.ipv4, p, n ) ) return false;
+
+        std::size_t const total = r.ipv4->total_length.value();
+        std::size_t const k = r.ipv4->header_size();
+
+        if( total < k || total - k > n ) return false;
+
+        n = total - k;
+
+        if( r.ipv4->fragment_offset() == 0 )
+        {
+            protocol = r.ipv4->protocol.value();
+        }
+    }
+    else if( type == ether_type_ipv6 )
+    {
+        if( !detail::parse_next( r.ipv6, p, n ) ) return false;
+
+        std::size_t const length = r.ipv6->payload_length.value();
+
+        if( length > n ) return false;
+
+        n = length;
+        protocol = r.ipv6->next_header.value();
+    }
+    else
+    {
+        return true;
+    }
+
+    r.payload = p;
+    r.payload_size = n;
+
+    bool ok = true;
+
+    switch( protocol )
+    {
+    case ip_protocol_tcp:
+
+        ok = detail::parse_next( r.tcp, p, n );
+        break;
+
+    case ip_protocol_udp:
+
+        ok = detail::parse_next( r.udp, p, n );
+        break;
+
+    case ip_protocol_icmp:
+
+        if( r.ipv4 ) ok = detail::parse_next( r.icmp, p, n );
+        break;
+
+    case ip_protocol_icmpv6:
+
+        if( r.ipv6 ) ok = detail::parse_next( r.icmp, p, n );
+        break;
+    }
+
+    if( ok )
+    {
+        r.payload = p;
+        r.payload_size = n;
+    }
+
+    return ok;
+}
+
+// Effects: parse_packet( out[ i ], packets[ i ], sizes[ i ] ) for i in
+// [ 0, n ), with the headers of packet i + prefetch_distance prefetched
+// while packet i is parsed
+//
+// Returns: the number of packets for which parse_packet returned true
+
+inline std::size_t parse_packets( parsed_packet * out, unsigned char const * const * packets, std::size_t const * sizes, std::size_t n, std::size_t prefetch_distance = 4 ) BOOST_NOEXCEPT
+{
+    std::size_t m = n < prefetch_distance? n: prefetch_distance;
+
+    for( std::size_t i = 0; i < m; ++i )
+    {
+        detail::prefetch( packets[ i ] );
+    }
+
+    std::size_t r = 0;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        if( i + prefetch_distance < n )
+        {
+            detail::prefetch( packets[ i + prefetch_distance ] );
+        }
+
+        r += parse_packet( out[ i ], packets[ i ], sizes[ i ] );
+    }
+
+    return r;
+}
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_NET_HEADERS_HPP_INCLUDED
@@ -0,0 +1,216 @@
+#ifndef BOOST_ENDIAN_PCM_HPP_INCLUDED
+#define BOOST_ENDIAN_PCM_HPP_INCLUDED
+
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Conversion between interleaved PCM audio samples of N bytes stored in a
+// given byte order (24-bit AIFF is big endian, 24-bit WAV little endian)
+// and planar int32 or float channel buffers.
+//
+// Deinterleaving loads, sign extends, converts and scatters each sample in
+// one pass. The float versions map the full range of N-byte samples onto
+// [ -1, 1 ); packing from float rounds to nearest and clamps.
+
+#include <boost/endian/detail/endian_load.hpp>
+#include <boost/endian/detail/endian_store.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace endian
+{
+
+namespace detail
+{
+
+// D is std::int32_t or float; the conversions between a sample and D
+
+template<std::size_t N> struct pcm_traits
+{
+    BOOST_ENDIAN_STATIC_ASSERT( N >= 1 && N <= 4 );
+
+    static const std::int32_t max = static_cast<std::int32_t>( ( std::uint32_t( 1 ) << ( N * 8 - 1 ) ) - 1 );
+    static const std::int32_t min = -max - 1;
+
+    static void convert( std::int32_t & d, std::int32_t v ) BOOST_NOEXCEPT
+    {
+        d = v;
+    }
+
+    static void convert( float & d, std::int32_t v ) BOOST_NOEXCEPT
+    {
+        d = static_cast<float>( v ) * ( 1.0f / ( static_cast<float>( max ) + 1.0f ) );
+    }
+
+    static std::int32_t sample( std::int32_t v ) BOOST_NOEXCEPT
+    {
+        return v;
+    }
+
+    static std::int32_t sample( float v ) BOOST_NOEXCEPT
+    {
+        // NaN fails both comparisons below; it is silence
+        if( v != v ) return 0;
+
+        std::int32_t const lo = min, hi = max;
+
+        // double holds every 32-bit sample exactly
+        double x = static_cast<double>( v ) * ( static_cast<double>( hi ) + 1.0 );
+
+        x = x < 0? x - 0.5: x + 0.5;
+
+        return x <= lo? lo: x >= hi? hi: static_cast<std::int32_t>( x );
+    }
+};
+
+// the channel count is a constant for mono and stereo, so that the inner
+// loop is unrolled; C == 0 means a run time count
+
+template<std::size_t N, order Order, std::size_t C> struct pcm_impl
+{
+    template<class D> static void deinterleave( D * const * planes, unsigned char const * src, std::size_t frames, std::size_t ) BOOST_NOEXCEPT
+    {
+        for( std::size_t i = 0; i < frames; ++i, src += C * N )
+        {
+            for( std::size_t c = 0; c < C; ++c )
+            {
+                pcm_traits<N>::convert( planes[ c ][ i ], boost::endian::endian_load<std::int32_t, N, Order>( src + c * N ) );
+            }
+        }
+    }
+
+    template<class D> static void interleave( unsigned char * dst, D const * const * planes, std::size_t frames, std::size_t ) BOOST_NOEXCEPT
+    {
+        for( std::size_t i = 0; i < frames; ++i, dst += C * N )
+        {
+            for( std::size_t c = 0; c < C; ++c )
+            {
+                boost::endian::endian_store<std::int32_t, N, Order>( dst + c * N, pcm_traits<N>::sample( planes[ c ][ i ] ) );
+            }
+        }
+    }
+};
+
+template<std::size_t N, order Order> struct pcm_impl<N, Order, 0>
+{
+    template<class D> static void deinterleave( D * const * planes, unsigned char const * src, std::size_t frames, std::size_t channels ) BOOST_NOEXCEPT
+    {
+        for( std::size_t i = 0; i < frames; ++i, src += channels * N )
+        {
+            for( std::size_t c = 0; c < channels; ++c )
+            {
+                pcm_traits<N>::convert( planes[ c ][ i ], boost::endian::endian_load<std::int32_t, N, Order>( src + c * N ) );
+            }
+        }
+    }
+
+    template<class D> static void interleave( unsigned char * dst, D const * const * planes, std::size_t frames, std::size_t channels ) BOOST_NOEXCEPT
+    {
+        for( std::size_t i = 0; i < frames; ++i, dst += channels * N )
+        {
+            for( std::size_t c = 0; c < channels; ++c )
+            {
+                boost::endian::endian_store<std::int32_t, N, Order>( dst + c * N, pcm_traits<N>::sample( planes[ c ][ i ] ) );
+            }
+        }
+    }
+};
+
+template<std::size_t N, order Order, class D>
+inline void pcm_deinterleave_impl( D * const * planes, unsigned char const * src, std::size_t frames, std::size_t channels ) BOOST_NOEXCEPT
+{
+    switch( channels )
+    {
+    case 1:
+
+        pcm_impl<N, Order, 1>::deinterleave( planes, src, frames, channels );
+        break;
+
+    case 2:
+
+        pcm_impl<N, Order, 2>::deinterleave( planes, src, frames, channels );
+        break;
+
+    default:
+
+        pcm_impl<N, Order, 0>::deinterleave( planes, src, frames, channels );
+        break;
+    }
+}
+
+template<std::size_t N, order Order, class D>
+inline void pcm_interleave_impl( unsigned char * dst, D const * const * planes, std::size_t frames, std::size_t channels ) BOOST_NOEXCEPT
+{
+    switch( channels )
+    {
+    case 1:
+
+        pcm_impl<N, Order, 1>::interleave( dst, planes, frames, channels );
+        break;
+
+    case 2:
+
+        pcm_impl<N, Order, 2>::interleave( dst, planes, frames, channels );
+        break;
+
+    default:
+
+        pcm_impl<N, Order, 0>::interleave( dst, planes, frames, channels );
+        break;
+    }
+}
+
+} // namespace detail
+
+// Requires:
+//
+//    1 <= N <= 4
+//    src points to frames * channels interleaved signed N-byte samples
+//    planes points to channels pointers to storage for frames values
+//
+// Effects: planes[ c ][ i ] is sample c of frame i, sign extended, or for
+// float, scaled by 2^-(8N-1)
+
+template<std::size_t N, order Order>
+inline void pcm_deinterleave( std::int32_t * const * planes, unsigned char const * src, std::size_t frames, std::size_t channels ) BOOST_NOEXCEPT
+{
+    detail::pcm_deinterleave_impl<N, Order>( planes, src, frames, channels );
+}
+
+template<std::size_t N, order Order>
+inline void pcm_deinterleave( float * const * planes, unsigned char const * src, std::size_t frames, std::size_t channels ) BOOST_NOEXCEPT
+{
+    detail::pcm_deinterleave_impl<N, Order>( planes, src, frames, channels );
+}
+
+// Requires:
+//
+//    1 <= N <= 4
+//    dst points to storage for frames * channels N-byte samples
+//    planes points to channels pointers to frames values
+//
+// Effects: the reverse of pcm_deinterleave; int32 values are truncated to N
+// bytes, float values are scaled by 2^(8N-1), rounded and clamped
+
+template<std::size_t N, order Order>
+inline void pcm_interleave( unsigned char * dst, std::int32_t const * const * planes, std::size_t frames, std::size_t channels ) BOOST_NOEXCEPT
+{
+    detail::pcm_interleave_impl<N, Order>( dst, planes, frames, channels );
+}
+
+template<std::size_t N, order Order>
+inline void pcm_interleave( unsigned char * dst, float const * const * planes, std::size_t frames, std::size_t channels ) BOOST_NOEXCEPT
+{
+    detail::pcm_interleave_impl<N, Order>( dst, planes, frames, channels );
+}
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_PCM_HPP_INCLUDED
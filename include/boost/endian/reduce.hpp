@@ -0,0 +1,283 @@
+#ifndef BOOST_ENDIAN_REDUCE_HPP_INCLUDED
+#define BOOST_ENDIAN_REDUCE_HPP_INCLUDED
+
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Reductions over arrays of N-byte values stored in a given byte order.
+//
+// Each element is loaded with endian_load and folded into the result in the
+// same loop, so the data is read once and never materialized in native order.
+// The loops keep four independent accumulators to break the dependency chain,
+// which lets the compiler vectorize the load/reverse/accumulate sequence.
+
+#include <boost/endian/detail/endian_load.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/endian/buffers.hpp>
+#include <boost/config.hpp>
+#include <type_traits>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+namespace boost
+{
+namespace endian
+{
+
+namespace detail
+{
+
+// widened accumulator: std::int64_t for signed integers, std::uint64_t for
+// unsigned integers, double for floating point
+//
+// Integers are summed in std::uint64_t, whose overflow is well defined, and
+// only the result is converted to the accumulator type.
+
+template<class T, bool I = std::is_integral<T>::value, bool S = std::is_signed<T>::value> struct endian_accumulator
+{
+    typedef double type;
+    typedef double work_type;
+};
+
+template<class T> struct endian_accumulator<T, true, true>
+{
+    typedef std::int64_t type;
+    typedef std::uint64_t work_type;
+};
+
+template<class T> struct endian_accumulator<T, true, false>
+{
+    typedef std::uint64_t type;
+    typedef std::uint64_t work_type;
+};
+
+inline unsigned endian_popcount_impl( std::uint64_t x ) BOOST_NOEXCEPT
+{
+#if defined(__GNUC__) || defined(__clang__)
+
+    return static_cast<unsigned>( __builtin_popcountll( x ) );
+
+#else
+
+    x = x - ( ( x >> 1 ) & 0x5555555555555555ull );
+    x = ( x & 0x3333333333333333ull ) + ( ( x >> 2 ) & 0x3333333333333333ull );
+    x = ( x + ( x >> 4 ) ) & 0x0F0F0F0F0F0F0F0Full;
+
+    return static_cast<unsigned>( ( x * 0x0101010101010101ull ) >> 56 );
+
+#endif
+}
+
+} // namespace detail
+
+// Requires:
+//
+//    T, N, Order as for endian_load
+//    p points to n consecutive N-byte values
+
+// sum, in the widened accumulator type
+//
+// An integer sum that does not fit in 64 bits wraps around modulo 2^64.
+
+template<class T, std::size_t N, order Order>
+inline typename detail::endian_accumulator<T>::type endian_sum( unsigned char const * p, std::size_t n ) BOOST_NOEXCEPT
+{
+    typedef typename detail::endian_accumulator<T>::work_type A;
+
+    A s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+
+    std::size_t i = 0;
+
+    for( ; i + 4 <= n; i += 4, p += 4 * N )
+    {
+        s0 += static_cast<A>( boost::endian::endian_load<T, N, Order>( p ) );
+        s1 += static_cast<A>( boost::endian::endian_load<T, N, Order>( p + N ) );
+        s2 += static_cast<A>( boost::endian::endian_load<T, N, Order>( p + 2 * N ) );
+        s3 += static_cast<A>( boost::endian::endian_load<T, N, Order>( p + 3 * N ) );
+    }
+
+    for( ; i < n; ++i, p += N )
+    {
+        s0 += static_cast<A>( boost::endian::endian_load<T, N, Order>( p ) );
+    }
+
+    return static_cast<typename detail::endian_accumulator<T>::type>( ( s0 + s1 ) + ( s2 + s3 ) );
+}
+
+// minimum and maximum; n must be at least 1
+
+template<class T, std::size_t N, order Order>
+inline std::pair<T, T> endian_minmax( unsigned char const * p, std::size_t n ) BOOST_NOEXCEPT
+{
+    T lo = boost::endian::endian_load<T, N, Order>( p );
+    T hi = lo;
+
+    for( std::size_t i = 1; i < n; ++i )
+    {
+        T x = boost::endian::endian_load<T, N, Order>( p + i * N );
+
+        lo = x < lo? x: lo;
+        hi = hi < x? x: hi;
+    }
+
+    return std::pair<T, T>( lo, hi );
+}
+
+template<class T, std::size_t N, order Order>
+inline T endian_min( unsigned char const * p, std::size_t n ) BOOST_NOEXCEPT
+{
+    T lo = boost::endian::endian_load<T, N, Order>( p );
+
+    for( std::size_t i = 1; i < n; ++i )
+    {
+        T x = boost::endian::endian_load<T, N, Order>( p + i * N );
+        lo = x < lo? x: lo;
+    }
+
+    return lo;
+}
+
+template<class T, std::size_t N, order Order>
+inline T endian_max( unsigned char const * p, std::size_t n ) BOOST_NOEXCEPT
+{
+    T hi = boost::endian::endian_load<T, N, Order>( p );
+
+    for( std::size_t i = 1; i < n; ++i )
+    {
+        T x = boost::endian::endian_load<T, N, Order>( p + i * N );
+        hi = hi < x? x: hi;
+    }
+
+    return hi;
+}
+
+// mean and population variance
+//
+// Computed in one pass over the values shifted by the first element, which
+// keeps the sum of squares well conditioned for data with a large offset.
+
+struct endian_statistics
+{
+    std::size_t count;
+    double mean;
+    double variance;
+};
+
+template<class T, std::size_t N, order Order>
+inline endian_statistics endian_stats( unsigned char const * p, std::size_t n ) BOOST_NOEXCEPT
+{
+    endian_statistics r = { n, 0.0, 0.0 };
+
+    if( n == 0 ) return r;
+
+    double const k = static_cast<double>( boost::endian::endian_load<T, N, Order>( p ) );
+
+    double s0 = 0, s1 = 0, q0 = 0, q1 = 0;
+
+    std::size_t i = 0;
+
+    for( ; i + 2 <= n; i += 2, p += 2 * N )
+    {
+        double d0 = static_cast<double>( boost::endian::endian_load<T, N, Order>( p ) ) - k;
+        double d1 = static_cast<double>( boost::endian::endian_load<T, N, Order>( p + N ) ) - k;
+
+        s0 += d0; q0 += d0 * d0;
+        s1 += d1; q1 += d1 * d1;
+    }
+
+    if( i < n )
+    {
+        double d0 = static_cast<double>( boost::endian::endian_load<T, N, Order>( p ) ) - k;
+        s0 += d0; q0 += d0 * d0;
+    }
+
+    double const s = s0 + s1;
+    double const q = q0 + q1;
+    double const m = s / static_cast<double>( n );
+
+    r.mean = k + m;
+    r.variance = q / static_cast<double>( n ) - m * m;
+
+    if( r.variance < 0 ) r.variance = 0;
+
+    return r;
+}
+
+// number of set bits in n bytes
+//
+// Bit counts do not depend on byte order, so no reversal takes place.
+
+inline std::size_t endian_popcount( unsigned char const * p, std::size_t n ) BOOST_NOEXCEPT
+{
+    std::size_t r = 0;
+
+    std::size_t i = 0;
+
+    for( ; i + 8 <= n; i += 8 )
+    {
+        std::uint64_t w;
+        std::memcpy( &w, p + i, 8 );
+
+        r += detail::endian_popcount_impl( w );
+    }
+
+    for( ; i < n; ++i )
+    {
+        r += detail::endian_popcount_impl( p[ i ] );
+    }
+
+    return r;
+}
+
+// overloads for arrays of endian_buffer
+
+template<order Order, class T, std::size_t n_bits, align A>
+inline typename detail::endian_accumulator<T>::type endian_sum( endian_buffer<Order, T, n_bits, A> const * p, std::size_t n ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof( endian_buffer<Order, T, n_bits, A> ) == n_bits / 8 );
+    return boost::endian::endian_sum<T, n_bits / 8, Order>( reinterpret_cast<unsigned char const*>( p ), n );
+}
+
+template<order Order, class T, std::size_t n_bits, align A>
+inline std::pair<T, T> endian_minmax( endian_buffer<Order, T, n_bits, A> const * p, std::size_t n ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof( endian_buffer<Order, T, n_bits, A> ) == n_bits / 8 );
+    return boost::endian::endian_minmax<T, n_bits / 8, Order>( reinterpret_cast<unsigned char const*>( p ), n );
+}
+
+template<order Order, class T, std::size_t n_bits, align A>
+inline T endian_min( endian_buffer<Order, T, n_bits, A> const * p, std::size_t n ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof( endian_buffer<Order, T, n_bits, A> ) == n_bits / 8 );
+    return boost::endian::endian_min<T, n_bits / 8, Order>( reinterpret_cast<unsigned char const*>( p ), n );
+}
+
+template<order Order, class T, std::size_t n_bits, align A>
+inline T endian_max( endian_buffer<Order, T, n_bits, A> const * p, std::size_t n ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof( endian_buffer<Order, T, n_bits, A> ) == n_bits / 8 );
+    return boost::endian::endian_max<T, n_bits / 8, Order>( reinterpret_cast<unsigned char const*>( p ), n );
+}
+
+template<order Order, class T, std::size_t n_bits, align A>
+inline endian_statistics endian_stats( endian_buffer<Order, T, n_bits, A> const * p, std::size_t n ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof( endian_buffer<Order, T, n_bits, A> ) == n_bits / 8 );
+    return boost::endian::endian_stats<T, n_bits / 8, Order>( reinterpret_cast<unsigned char const*>( p ), n );
+}
+
+template<order Order, class T, std::size_t n_bits, align A>
+inline std::size_t endian_popcount( endian_buffer<Order, T, n_bits, A> const * p, std::size_t n ) BOOST_NOEXCEPT
+{
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof( endian_buffer<Order, T, n_bits, A> ) == n_bits / 8 );
+    return boost::endian::endian_popcount( reinterpret_cast<unsigned char const*>( p ), n * ( n_bits / 8 ) );
+}
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_REDUCE_HPP_INCLUDED
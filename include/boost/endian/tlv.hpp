@@ -0,0 +1,248 @@
+#ifndef BOOST_ENDIAN_TLV_HPP_INCLUDED
+#define BOOST_ENDIAN_TLV_HPP_INCLUDED
+
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Iteration over type-length-value records: a TypeWidth-byte type and a
+// LenWidth-byte length, both in the byte order Order, followed by length
+// bytes of value.
+//
+//    for( tlv_record r: tlv_range<1, 2>( p, size ) )
+//    {
+//        // r.type, r.value, r.length
+//    }
+//
+// The values are not copied. Iteration stops at the first record whose
+// header or value does not fit in the data; ok() tells whether all of it
+// was made of complete records.
+//
+// Since each record starts where the previous one ends, finding the n-th
+// record means walking all the ones before it. build_index walks them once
+// and records their offsets, reading nothing but the lengths, so that
+// record_at can then reach any of them directly.
+
+#include <boost/endian/detail/endian_load.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/config.hpp>
+#include <iterator>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace endian
+{
+
+struct tlv_record
+{
+    std::uint64_t type;
+
+    unsigned char const * value;
+    std::size_t length;
+
+    // the offset of the record from the start of the data
+    std::size_t offset;
+};
+
+namespace detail
+{
+
+// Returns: the size of the record at the start of [ p, p + n ), header
+// included, or 0 if it does not fit
+
+template<std::size_t TypeWidth, std::size_t LenWidth, order Order>
+inline std::size_t tlv_record_size( unsigned char const * p, std::size_t n ) BOOST_NOEXCEPT
+{
+    std::size_t const header = TypeWidth + LenWidth;
+
+    if( n < header ) return 0;
+
+    std::uint64_t const length = boost::endian::endian_load<std::uint64_t, LenWidth, Order>( p + TypeWidth );
+
+    if( length > n - header ) return 0;
+
+    return header + static_cast<std::size_t>( length );
+}
+
+} // namespace detail
+
+template<std::size_t TypeWidth, std::size_t LenWidth, order Order = order::big> class tlv_range
+{
+private:
+
+    BOOST_ENDIAN_STATIC_ASSERT( TypeWidth >= 1 && TypeWidth <= 8 );
+    BOOST_ENDIAN_STATIC_ASSERT( LenWidth >= 1 && LenWidth <= 8 );
+
+    unsigned char const * data_;
+    std::size_t size_;
+
+public:
+
+    static BOOST_CONSTEXPR_OR_CONST std::size_t header_size = TypeWidth + LenWidth;
+
+    class iterator
+    {
+    private:
+
+        unsigned char const * data_;
+        std::size_t size_;
+
+        std::size_t offset_;
+
+        // the size of the current record; 0 at the end
+        std::size_t record_size_;
+
+        void parse() BOOST_NOEXCEPT
+        {
+            record_size_ = detail::tlv_record_size<TypeWidth, LenWidth, Order>( data_ + offset_, size_ - offset_ );
+        }
+
+    public:
+
+        typedef std::forward_iterator_tag iterator_category;
+        typedef tlv_record value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef tlv_record const * pointer;
+        typedef tlv_record reference;
+
+        iterator() BOOST_NOEXCEPT: data_( 0 ), size_( 0 ), offset_( 0 ), record_size_( 0 )
+        {
+        }
+
+        iterator( unsigned char const * data, std::size_t size, std::size_t offset ) BOOST_NOEXCEPT: data_( data ), size_( size ), offset_( offset ), record_size_( 0 )
+        {
+            parse();
+        }
+
+        tlv_record operator*() const BOOST_NOEXCEPT
+        {
+            unsigned char const * p = data_ + offset_;
+
+            tlv_record r;
+
+            r.type = boost::endian::endian_load<std::uint64_t, TypeWidth, Order>( p );
+            r.value = p + header_size;
+            r.length = record_size_ - header_size;
+            r.offset = offset_;
+
+            return r;
+        }
+
+        iterator & operator++() BOOST_NOEXCEPT
+        {
+            offset_ += record_size_;
+            parse();
+
+            return *this;
+        }
+
+        iterator operator++( int ) BOOST_NOEXCEPT
+        {
+            iterator r( *this );
+            ++*this;
+            return r;
+        }
+
+        // all iterators past the last complete record are equal
+
+        bool operator==( iterator const & rhs ) const BOOST_NOEXCEPT
+        {
+            return record_size_ == 0? rhs.record_size_ == 0: offset_ == rhs.offset_ && data_ == rhs.data_;
+        }
+
+        bool operator!=( iterator const & rhs ) const BOOST_NOEXCEPT
+        {
+            return !( *this == rhs );
+        }
+
+        // the offset of the current record, or of the end of the complete
+        // records at the end
+
+        std::size_t offset() const BOOST_NOEXCEPT
+        {
+            return offset_;
+        }
+    };
+
+    tlv_range( unsigned char const * data, std::size_t size ) BOOST_NOEXCEPT: data_( data ), size_( size )
+    {
+    }
+
+    iterator begin() const BOOST_NOEXCEPT
+    {
+        return iterator( data_, size_, 0 );
+    }
+
+    iterator end() const BOOST_NOEXCEPT
+    {
+        return iterator();
+    }
+
+    // Returns: the size of the complete records at the start of the data
+
+    std::size_t valid_size() const BOOST_NOEXCEPT
+    {
+        std::size_t offset = 0;
+
+        for( ;; )
+        {
+            std::size_t const k = detail::tlv_record_size<TypeWidth, LenWidth, Order>( data_ + offset, size_ - offset );
+
+            if( k == 0 ) return offset;
+
+            offset += k;
+        }
+    }
+
+    // Returns: whether the data is made of complete records only
+
+    bool ok() const BOOST_NOEXCEPT
+    {
+        return valid_size() == size_;
+    }
+
+    // Effects: appends the offsets of the complete records to offsets
+    // Returns: ok()
+
+    bool build_index( std::vector<std::size_t> & offsets ) const
+    {
+        std::size_t offset = 0;
+
+        for( ;; )
+        {
+            std::size_t const k = detail::tlv_record_size<TypeWidth, LenWidth, Order>( data_ + offset, size_ - offset );
+
+            if( k == 0 ) return offset == size_;
+
+            offsets.push_back( offset );
+            offset += k;
+        }
+    }
+
+    // Requires: offset is the offset of a complete record, as stored by
+    // build_index or returned in tlv_record::offset
+
+    tlv_record record_at( std::size_t offset ) const BOOST_NOEXCEPT
+    {
+        return *iterator( data_, size_, offset );
+    }
+
+    unsigned char const * data() const BOOST_NOEXCEPT
+    {
+        return data_;
+    }
+
+    std::size_t size() const BOOST_NOEXCEPT
+    {
+        return size_;
+    }
+};
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_TLV_HPP_INCLUDED
@@ -0,0 +1,414 @@
+#ifndef BOOST_ENDIAN_UTF_HPP_INCLUDED
+#define BOOST_ENDIAN_UTF_HPP_INCLUDED
+
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Transcoding between UTF-16 or UTF-32 text stored in a given byte order
+// (UTF-16BE, UTF-16LE, UTF-32BE, UTF-32LE) and native UTF-16 or UTF-8, with
+// the byte order conversion done as part of the decoding loop.
+//
+// Runs of ASCII are handled four UTF-16 code units, or eight UTF-8 bytes, at
+// a time, with a single 8-byte load and mask test.
+//
+// All functions validate their input: unpaired surrogates, code points
+// above U+10FFFF, and overlong or truncated UTF-8 sequences are rejected.
+// Lengths are in code units of the source and destination encodings.
+
+#include <boost/endian/detail/endian_load.hpp>
+#include <boost/endian/detail/endian_store.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace endian
+{
+
+struct utf_result
+{
+    // code units of the source that were consumed; when !ok, the invalid
+    // sequence starts there
+    std::size_t read;
+
+    // code units written to the destination
+    std::size_t written;
+
+    bool ok;
+};
+
+namespace detail
+{
+
+inline utf_result utf_make_result( std::size_t read, std::size_t written, bool ok ) BOOST_NOEXCEPT
+{
+    utf_result r = { read, written, ok };
+    return r;
+}
+
+inline bool utf_is_surrogate( std::uint32_t c ) BOOST_NOEXCEPT
+{
+    return ( c & 0xFFFFF800u ) == 0xD800u;
+}
+
+// Requires: c is a valid code point
+// Returns: the number of bytes written
+
+inline std::size_t utf8_put( char * dst, std::uint32_t c ) BOOST_NOEXCEPT
+{
+    if( c < 0x80 )
+    {
+        dst[ 0 ] = static_cast<char>( c );
+        return 1;
+    }
+    else if( c < 0x800 )
+    {
+        dst[ 0 ] = static_cast<char>( 0xC0 | ( c >> 6 ) );
+        dst[ 1 ] = static_cast<char>( 0x80 | ( c & 0x3F ) );
+        return 2;
+    }
+    else if( c < 0x10000 )
+    {
+        dst[ 0 ] = static_cast<char>( 0xE0 | ( c >> 12 ) );
+        dst[ 1 ] = static_cast<char>( 0x80 | ( ( c >> 6 ) & 0x3F ) );
+        dst[ 2 ] = static_cast<char>( 0x80 | ( c & 0x3F ) );
+        return 3;
+    }
+    else
+    {
+        dst[ 0 ] = static_cast<char>( 0xF0 | ( c >> 18 ) );
+        dst[ 1 ] = static_cast<char>( 0x80 | ( ( c >> 12 ) & 0x3F ) );
+        dst[ 2 ] = static_cast<char>( 0x80 | ( ( c >> 6 ) & 0x3F ) );
+        dst[ 3 ] = static_cast<char>( 0x80 | ( c & 0x3F ) );
+        return 4;
+    }
+}
+
+// Effects: decodes one code point from [ src, src + n ), n > 0
+// Returns: the number of bytes consumed, or 0 if the sequence is invalid
+
+inline std::size_t utf8_get( unsigned char const * src, std::size_t n, std::uint32_t & c ) BOOST_NOEXCEPT
+{
+    std::uint32_t const b0 = src[ 0 ];
+
+    if( b0 < 0x80 )
+    {
+        c = b0;
+        return 1;
+    }
+
+    std::size_t k;
+    std::uint32_t min;
+
+    if( ( b0 & 0xE0 ) == 0xC0 )
+    {
+        k = 2;
+        c = b0 & 0x1F;
+        min = 0x80;
+    }
+    else if( ( b0 & 0xF0 ) == 0xE0 )
+    {
+        k = 3;
+        c = b0 & 0x0F;
+        min = 0x800;
+    }
+    else if( ( b0 & 0xF8 ) == 0xF0 )
+    {
+        k = 4;
+        c = b0 & 0x07;
+        min = 0x10000;
+    }
+    else
+    {
+        return 0;
+    }
+
+    if( n < k ) return 0;
+
+    for( std::size_t i = 1; i < k; ++i )
+    {
+        std::uint32_t const b = src[ i ];
+
+        if( ( b & 0xC0 ) != 0x80 ) return 0;
+
+        c = ( c << 6 ) | ( b & 0x3F );
+    }
+
+    if( c < min || c > 0x10FFFF || utf_is_surrogate( c ) ) return 0;
+
+    return k;
+}
+
+// Effects: decodes one code point from the UTF-16 units at src, n > 0
+// Returns: the number of units consumed, or 0 if unpaired
+
+template<order Order> inline std::size_t utf16_get( unsigned char const * src, std::size_t n, std::uint32_t & c ) BOOST_NOEXCEPT
+{
+    std::uint32_t const u0 = boost::endian::endian_load<std::uint16_t, 2, Order>( src );
+
+    if( !utf_is_surrogate( u0 ) )
+    {
+        c = u0;
+        return 1;
+    }
+
+    if( u0 >= 0xDC00 || n < 2 ) return 0;
+
+    std::uint32_t const u1 = boost::endian::endian_load<std::uint16_t, 2, Order>( src + 2 );
+
+    if( ( u1 & 0xFC00 ) != 0xDC00 ) return 0;
+
+    c = 0x10000 + ( ( u0 - 0xD800 ) << 10 ) + ( u1 - 0xDC00 );
+    return 2;
+}
+
+// tests four UTF-16 code units in the given order for ASCII with a single
+// native 8-byte load; in the native view the high byte of each unit is the
+// upper half of its 16-bit lane when the text order is native, and the lower
+// half otherwise
+
+template<order Order> inline bool utf16_ascii4( unsigned char const * src ) BOOST_NOEXCEPT
+{
+    std::uint64_t const mask = Order == order::native? 0xFF80FF80FF80FF80ull: 0x80FF80FF80FF80FFull;
+    return ( boost::endian::endian_load<std::uint64_t, 8, order::native>( src ) & mask ) == 0;
+}
+
+} // namespace detail
+
+// UTF-16 in the given order to UTF-8
+//
+// Requires: dst has room for 3 * n bytes
+
+template<order Order>
+inline utf_result utf16_to_utf8( char * dst, unsigned char const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    std::size_t i = 0, j = 0;
+
+    while( i < n )
+    {
+        if( n - i >= 4 && detail::utf16_ascii4<Order>( src + 2 * i ) )
+        {
+            for( std::size_t k = 0; k < 4; ++k )
+            {
+                dst[ j + k ] = static_cast<char>( src[ 2 * ( i + k ) + ( Order == order::big? 1: 0 ) ] );
+            }
+
+            i += 4;
+            j += 4;
+
+            continue;
+        }
+
+        std::uint32_t c;
+        std::size_t k = detail::utf16_get<Order>( src + 2 * i, n - i, c );
+
+        if( k == 0 ) return detail::utf_make_result( i, j, false );
+
+        i += k;
+        j += detail::utf8_put( dst + j, c );
+    }
+
+    return detail::utf_make_result( i, j, true );
+}
+
+// UTF-16 in the given order to native UTF-16
+//
+// Requires: dst has room for n units
+
+template<order Order>
+inline utf_result utf16_to_native( char16_t * dst, unsigned char const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    std::size_t i = 0;
+
+    while( i < n )
+    {
+        std::uint16_t const u = boost::endian::endian_load<std::uint16_t, 2, Order>( src + 2 * i );
+
+        if( detail::utf_is_surrogate( u ) )
+        {
+            std::uint32_t c;
+
+            if( detail::utf16_get<Order>( src + 2 * i, n - i, c ) == 0 ) return detail::utf_make_result( i, i, false );
+
+            dst[ i ] = static_cast<char16_t>( u );
+            dst[ i + 1 ] = static_cast<char16_t>( boost::endian::endian_load<std::uint16_t, 2, Order>( src + 2 * i + 2 ) );
+
+            i += 2;
+        }
+        else
+        {
+            dst[ i ] = static_cast<char16_t>( u );
+            ++i;
+        }
+    }
+
+    return detail::utf_make_result( i, i, true );
+}
+
+// UTF-32 in the given order to UTF-8
+//
+// Requires: dst has room for 4 * n bytes
+
+template<order Order>
+inline utf_result utf32_to_utf8( char * dst, unsigned char const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    std::size_t j = 0;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        std::uint32_t const c = boost::endian::endian_load<std::uint32_t, 4, Order>( src + 4 * i );
+
+        if( c > 0x10FFFF || detail::utf_is_surrogate( c ) ) return detail::utf_make_result( i, j, false );
+
+        j += detail::utf8_put( dst + j, c );
+    }
+
+    return detail::utf_make_result( n, j, true );
+}
+
+// UTF-32 in the given order to native UTF-16
+//
+// Requires: dst has room for 2 * n units
+
+template<order Order>
+inline utf_result utf32_to_utf16( char16_t * dst, unsigned char const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    std::size_t j = 0;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        std::uint32_t const c = boost::endian::endian_load<std::uint32_t, 4, Order>( src + 4 * i );
+
+        if( c > 0x10FFFF || detail::utf_is_surrogate( c ) ) return detail::utf_make_result( i, j, false );
+
+        if( c < 0x10000 )
+        {
+            dst[ j++ ] = static_cast<char16_t>( c );
+        }
+        else
+        {
+            dst[ j++ ] = static_cast<char16_t>( 0xD800 + ( ( c - 0x10000 ) >> 10 ) );
+            dst[ j++ ] = static_cast<char16_t>( 0xDC00 + ( ( c - 0x10000 ) & 0x3FF ) );
+        }
+    }
+
+    return detail::utf_make_result( n, j, true );
+}
+
+// encoders
+
+// UTF-8 to UTF-16 in the given order
+//
+// Requires: dst has room for 2 * n bytes (n units)
+
+template<order Order>
+inline utf_result utf8_to_utf16( unsigned char * dst, char const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    unsigned char const * s = reinterpret_cast<unsigned char const *>( src );
+
+    std::size_t i = 0, j = 0;
+
+    while( i < n )
+    {
+        if( n - i >= 8 && ( boost::endian::endian_load<std::uint64_t, 8, order::native>( s + i ) & 0x8080808080808080ull ) == 0 )
+        {
+            for( std::size_t k = 0; k < 8; ++k )
+            {
+                boost::endian::endian_store<std::uint16_t, 2, Order>( dst + 2 * ( j + k ), s[ i + k ] );
+            }
+
+            i += 8;
+            j += 8;
+
+            continue;
+        }
+
+        std::uint32_t c;
+        std::size_t k = detail::utf8_get( s + i, n - i, c );
+
+        if( k == 0 ) return detail::utf_make_result( i, j, false );
+
+        i += k;
+
+        if( c < 0x10000 )
+        {
+            boost::endian::endian_store<std::uint16_t, 2, Order>( dst + 2 * j, static_cast<std::uint16_t>( c ) );
+            j += 1;
+        }
+        else
+        {
+            boost::endian::endian_store<std::uint16_t, 2, Order>( dst + 2 * j, static_cast<std::uint16_t>( 0xD800 + ( ( c - 0x10000 ) >> 10 ) ) );
+            boost::endian::endian_store<std::uint16_t, 2, Order>( dst + 2 * j + 2, static_cast<std::uint16_t>( 0xDC00 + ( ( c - 0x10000 ) & 0x3FF ) ) );
+            j += 2;
+        }
+    }
+
+    return detail::utf_make_result( i, j, true );
+}
+
+// UTF-8 to UTF-32 in the given order
+//
+// Requires: dst has room for 4 * n bytes (n units)
+
+template<order Order>
+inline utf_result utf8_to_utf32( unsigned char * dst, char const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    unsigned char const * s = reinterpret_cast<unsigned char const *>( src );
+
+    std::size_t i = 0, j = 0;
+
+    while( i < n )
+    {
+        std::uint32_t c;
+        std::size_t k = detail::utf8_get( s + i, n - i, c );
+
+        if( k == 0 ) return detail::utf_make_result( i, j, false );
+
+        i += k;
+
+        boost::endian::endian_store<std::uint32_t, 4, Order>( dst + 4 * j, c );
+        ++j;
+    }
+
+    return detail::utf_make_result( i, j, true );
+}
+
+// native UTF-16 to UTF-16 in the given order
+//
+// Requires: dst has room for 2 * n bytes
+
+template<order Order>
+inline utf_result native_to_utf16( unsigned char * dst, char16_t const * src, std::size_t n ) BOOST_NOEXCEPT
+{
+    std::size_t i = 0;
+
+    while( i < n )
+    {
+        std::uint16_t const u = static_cast<std::uint16_t>( src[ i ] );
+
+        if( detail::utf_is_surrogate( u ) )
+        {
+            if( u >= 0xDC00 || n - i < 2 || ( src[ i + 1 ] & 0xFC00 ) != 0xDC00 ) return detail::utf_make_result( i, i, false );
+
+            boost::endian::endian_store<std::uint16_t, 2, Order>( dst + 2 * i, u );
+            boost::endian::endian_store<std::uint16_t, 2, Order>( dst + 2 * i + 2, static_cast<std::uint16_t>( src[ i + 1 ] ) );
+
+            i += 2;
+        }
+        else
+        {
+            boost::endian::endian_store<std::uint16_t, 2, Order>( dst + 2 * i, u );
+            ++i;
+        }
+    }
+
+    return detail::utf_make_result( i, i, true );
+}
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_UTF_HPP_INCLUDED
@@ -0,0 +1,198 @@
+#ifndef BOOST_ENDIAN_VALIDATE_HPP_INCLUDED
+#define BOOST_ENDIAN_VALIDATE_HPP_INCLUDED
+
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Bulk loading of integer or enum fields stored in a given byte order,
+// checked against a set of valid values in the same pass:
+//
+//    std::size_t i = endian_validate<E, 2, order::big>( dst, src, n, range_validator<E>( E::first, E::last ) );
+//
+// Every value is loaded and checked, without an early exit, so that the
+// loop has no data dependent branch; the validity of a group of 64 values
+// is accumulated into a word and only the words with a bit clear are
+// examined further.
+//
+// The validator is any function object taking a T and returning bool;
+// range_validator, bitset_validator and table_validator cover the usual
+// cases of a contiguous range of values and of a sparse set of small ones.
+
+#include <boost/endian/detail/endian_load.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/endian/detail/static_assert.hpp>
+#include <boost/endian/buffers.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace endian
+{
+
+// the values in [ lo, hi ]; T is integral or an enum, scoped or not
+
+template<class T> struct range_validator
+{
+    T lo;
+    T hi;
+
+    range_validator( T lo_, T hi_ ) BOOST_NOEXCEPT: lo( lo_ ), hi( hi_ )
+    {
+    }
+
+    bool operator()( T v ) const BOOST_NOEXCEPT
+    {
+        return !( v < lo ) && !( hi < v );
+    }
+};
+
+// the values v < size for which bit v % 64 of bits[ v / 64 ] is set;
+// negative values are invalid
+
+struct bitset_validator
+{
+    std::uint64_t const * bits;
+    std::size_t size;
+
+    bitset_validator( std::uint64_t const * bits_, std::size_t size_ ) BOOST_NOEXCEPT: bits( bits_ ), size( size_ )
+    {
+    }
+
+    template<class T> bool operator()( T v ) const BOOST_NOEXCEPT
+    {
+        std::uint64_t const x = static_cast<std::uint64_t>( v );
+        return x < size && ( ( bits[ x / 64 ] >> ( x % 64 ) ) & 1 ) != 0;
+    }
+};
+
+// the values v < size for which table[ v ] is nonzero; negative values
+// are invalid
+
+struct table_validator
+{
+    unsigned char const * table;
+    std::size_t size;
+
+    table_validator( unsigned char const * table_, std::size_t size_ ) BOOST_NOEXCEPT: table( table_ ), size( size_ )
+    {
+    }
+
+    template<class T> bool operator()( T v ) const BOOST_NOEXCEPT
+    {
+        std::uint64_t const x = static_cast<std::uint64_t>( v );
+        return x < size && table[ x ] != 0;
+    }
+};
+
+namespace detail
+{
+
+// loads dst[ 0 .. m ), m <= 64; bit j of the result is set if dst[ j ] is valid
+
+template<class T, std::size_t N, order Order, class V>
+inline std::uint64_t endian_validate_word( T * dst, unsigned char const * src, std::size_t m, V const & v )
+{
+    std::uint64_t w = 0;
+
+    for( std::size_t j = 0; j < m; ++j )
+    {
+        T const x = boost::endian::endian_load<T, N, Order>( src + j * N );
+
+        dst[ j ] = x;
+        w |= static_cast<std::uint64_t>( static_cast<bool>( v( x ) ) ) << j;
+    }
+
+    return w;
+}
+
+inline std::size_t endian_validate_first_clear( std::uint64_t w ) BOOST_NOEXCEPT
+{
+    std::size_t r = 0;
+    for( ; w & 1; w >>= 1 ) ++r;
+    return r;
+}
+
+} // namespace detail
+
+// Requires:
+//
+//    T, N, Order as for endian_load; T is integral or an enum
+//    src points to n consecutive N-byte values
+//    dst points to storage for n values
+//    v( T ) returns a value convertible to bool
+//
+// Effects: dst[ i ] = endian_load<T, N, Order>( src + i * N ) for every i
+//
+// Returns: the index of the first value for which v returns false, or n
+
+template<class T, std::size_t N, order Order, class V>
+inline std::size_t endian_validate( T * dst, unsigned char const * src, std::size_t n, V v )
+{
+    std::size_t r = n;
+
+    for( std::size_t i = 0; i < n; i += 64 )
+    {
+        std::size_t const m = n - i < 64? n - i: 64;
+        std::uint64_t const all = m == 64? ~std::uint64_t( 0 ): ( std::uint64_t( 1 ) << m ) - 1;
+
+        std::uint64_t const w = detail::endian_validate_word<T, N, Order>( dst + i, src + i * N, m, v );
+
+        if( w != all && r == n )
+        {
+            r = i + detail::endian_validate_first_clear( w );
+        }
+    }
+
+    return r;
+}
+
+// As above; additionally, bit i % 64 of mask[ i / 64 ] is set if dst[ i ]
+// is valid, and cleared otherwise. mask points to ( n + 63 ) / 64 words;
+// the bits past n in the last word are cleared.
+
+template<class T, std::size_t N, order Order, class V>
+inline std::size_t endian_validate( T * dst, unsigned char const * src, std::size_t n, V v, std::uint64_t * mask )
+{
+    std::size_t r = n;
+
+    for( std::size_t i = 0; i < n; i += 64 )
+    {
+        std::size_t const m = n - i < 64? n - i: 64;
+        std::uint64_t const all = m == 64? ~std::uint64_t( 0 ): ( std::uint64_t( 1 ) << m ) - 1;
+
+        std::uint64_t const w = detail::endian_validate_word<T, N, Order>( dst + i, src + i * N, m, v );
+
+        mask[ i / 64 ] = w;
+
+        if( w != all && r == n )
+        {
+            r = i + detail::endian_validate_first_clear( w );
+        }
+    }
+
+    return r;
+}
+
+// overloads for arrays of endian_buffer
+
+template<order Order, class T, std::size_t n_bits, align A, class V>
+inline std::size_t endian_validate( T * dst, endian_buffer<Order, T, n_bits, A> const * src, std::size_t n, V v )
+{
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof( endian_buffer<Order, T, n_bits, A> ) == n_bits / 8 );
+    return boost::endian::endian_validate<T, n_bits / 8, Order>( dst, reinterpret_cast<unsigned char const*>( src ), n, v );
+}
+
+template<order Order, class T, std::size_t n_bits, align A, class V>
+inline std::size_t endian_validate( T * dst, endian_buffer<Order, T, n_bits, A> const * src, std::size_t n, V v, std::uint64_t * mask )
+{
+    BOOST_ENDIAN_STATIC_ASSERT( sizeof( endian_buffer<Order, T, n_bits, A> ) == n_bits / 8 );
+    return boost::endian::endian_validate<T, n_bits / 8, Order>( dst, reinterpret_cast<unsigned char const*>( src ), n, v, mask );
+}
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_VALIDATE_HPP_INCLUDED
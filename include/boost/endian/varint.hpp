@@ -0,0 +1,475 @@
+#ifndef BOOST_ENDIAN_VARINT_HPP_INCLUDED
+#define BOOST_ENDIAN_VARINT_HPP_INCLUDED
+
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Variable length integer encodings, as companions to the fixed width
+// load_* and store_* convenience functions in conversion.hpp:
+//
+//    zigzag        maps signed integers to unsigned ones, small magnitudes
+//                  to small values
+//    LEB128        7 bits per byte, least significant group first, high bit
+//                  set on every byte but the last (protobuf, DWARF, WASM)
+//    prefix varint the length (1 to 9 bytes) is given by the number of
+//                  trailing zero bits of the first byte; the value follows
+//                  in little endian order
+//    Stream VByte  blocks of four 32-bit values; one control byte holding
+//                  four 2-bit lengths, followed by the 1 to 4 byte values
+//
+// All decoding functions take the end of the input and return the number of
+// bytes consumed, or 0 if the input is truncated or malformed.
+
+#include <boost/endian/detail/endian_load.hpp>
+#include <boost/endian/detail/endian_store.hpp>
+#include <boost/endian/detail/order.hpp>
+#include <boost/endian/detail/intrinsic.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(__SSSE3__) && !defined(BOOST_ENDIAN_NO_INTRINSICS)
+# include <tmmintrin.h>
+# define BOOST_ENDIAN_VARINT_SSSE3
+#endif
+
+namespace boost
+{
+namespace endian
+{
+
+// zigzag
+
+inline BOOST_CONSTEXPR std::uint32_t zigzag_encode( std::int32_t v ) BOOST_NOEXCEPT
+{
+    return ( static_cast<std::uint32_t>( v ) << 1 ) ^ static_cast<std::uint32_t>( -static_cast<std::int32_t>( static_cast<std::uint32_t>( v ) >> 31 ) );
+}
+
+inline BOOST_CONSTEXPR std::uint64_t zigzag_encode( std::int64_t v ) BOOST_NOEXCEPT
+{
+    return ( static_cast<std::uint64_t>( v ) << 1 ) ^ static_cast<std::uint64_t>( -static_cast<std::int64_t>( static_cast<std::uint64_t>( v ) >> 63 ) );
+}
+
+inline BOOST_CONSTEXPR std::int32_t zigzag_decode( std::uint32_t v ) BOOST_NOEXCEPT
+{
+    return static_cast<std::int32_t>( ( v >> 1 ) ^ ( 0u - ( v & 1 ) ) );
+}
+
+inline BOOST_CONSTEXPR std::int64_t zigzag_decode( std::uint64_t v ) BOOST_NOEXCEPT
+{
+    return static_cast<std::int64_t>( ( v >> 1 ) ^ ( 0ull - ( v & 1 ) ) );
+}
+
+namespace detail
+{
+
+inline unsigned varint_ctz64( std::uint64_t x ) BOOST_NOEXCEPT
+{
+#if defined(__GNUC__) || defined(__clang__)
+
+    return static_cast<unsigned>( __builtin_ctzll( x ) );
+
+#else
+
+    unsigned r = 0;
+
+    while( ( x & 1 ) == 0 )
+    {
+        x >>= 1;
+        ++r;
+    }
+
+    return r;
+
+#endif
+}
+
+// compacts the low 7 bits of each of the eight bytes of x
+
+inline std::uint64_t leb128_compact( std::uint64_t x ) BOOST_NOEXCEPT
+{
+    return
+        (   x         & 0x000000000000007Full ) |
+        ( ( x >> 1 )  & 0x0000000000003F80ull ) |
+        ( ( x >> 2 )  & 0x00000000001FC000ull ) |
+        ( ( x >> 3 )  & 0x000000000FE00000ull ) |
+        ( ( x >> 4 )  & 0x00000007F0000000ull ) |
+        ( ( x >> 5 )  & 0x000003F800000000ull ) |
+        ( ( x >> 6 )  & 0x0001FC0000000000ull ) |
+        ( ( x >> 7 )  & 0x00FE000000000000ull );
+}
+
+template<std::size_t M> inline std::size_t load_leb128_impl( unsigned char const * p, unsigned char const * end, std::uint64_t & v ) BOOST_NOEXCEPT
+{
+    // M: maximum number of bytes; the last one may only hold the remaining bits
+
+    if( end - p >= 8 )
+    {
+        // all groups of a value of up to 8 bytes are extracted at once; the
+        // position of the first clear continuation bit gives the length
+
+        std::uint64_t w = boost::endian::endian_load<std::uint64_t, 8, order::little>( p );
+        std::uint64_t stop = ~w & 0x8080808080808080ull;
+
+        if( stop != 0 )
+        {
+            std::size_t n = detail::varint_ctz64( stop ) / 8 + 1;
+
+            if( n > M ) return 0;
+
+            // a redundant encoding ends with a zero group
+            if( n > 1 && ( ( w >> ( n * 8 - 8 ) ) & 0xFF ) == 0 ) return 0;
+
+            std::uint64_t m = n == 8? ~std::uint64_t( 0 ): ( std::uint64_t( 1 ) << ( n * 8 ) ) - 1;
+
+            v = detail::leb128_compact( w & m );
+            return n;
+        }
+    }
+
+    std::uint64_t r = 0;
+
+    for( std::size_t i = 0; i < M; ++i )
+    {
+        if( p + i == end ) return 0;
+
+        std::uint64_t b = p[ i ];
+
+        if( i == M - 1 && ( b >> ( M * 7 <= 64? 7: 64 - ( M - 1 ) * 7 ) ) != 0 ) return 0;
+
+        r |= ( b & 0x7F ) << ( i * 7 );
+
+        if( ( b & 0x80 ) == 0 )
+        {
+            if( b == 0 && i != 0 ) return 0;
+
+            v = r;
+            return i + 1;
+        }
+    }
+
+    return 0;
+}
+
+} // namespace detail
+
+// LEB128
+//
+// store_leb128_*: p must have room for 5 (u32) or 10 (u64) bytes.
+// Returns: the number of bytes written.
+//
+// load_leb128_* only accept the shortest encoding of a value: a final zero
+// byte after the first one, or bits past the width of the type in the last
+// byte, are rejected as overlong.
+
+inline std::size_t store_leb128_u64( unsigned char * p, std::uint64_t v ) BOOST_NOEXCEPT
+{
+    std::size_t n = 0;
+
+    while( v >= 0x80 )
+    {
+        p[ n++ ] = static_cast<unsigned char>( v | 0x80 );
+        v >>= 7;
+    }
+
+    p[ n++ ] = static_cast<unsigned char>( v );
+    return n;
+}
+
+inline std::size_t store_leb128_u32( unsigned char * p, std::uint32_t v ) BOOST_NOEXCEPT
+{
+    return store_leb128_u64( p, v );
+}
+
+inline std::size_t load_leb128_u64( unsigned char const * p, unsigned char const * end, std::uint64_t & v ) BOOST_NOEXCEPT
+{
+    return detail::load_leb128_impl<10>( p, end, v );
+}
+
+inline std::size_t load_leb128_u32( unsigned char const * p, unsigned char const * end, std::uint32_t & v ) BOOST_NOEXCEPT
+{
+    std::uint64_t w = 0;
+    std::size_t n = detail::load_leb128_impl<5>( p, end, w );
+
+    if( n == 0 || w > 0xFFFFFFFFu ) return 0;
+
+    v = static_cast<std::uint32_t>( w );
+    return n;
+}
+
+// decodes n consecutive LEB128 values
+// Returns: the number of bytes consumed, or 0 on error
+
+inline std::size_t load_leb128_n( std::uint64_t * dst, std::size_t n, unsigned char const * p, unsigned char const * end ) BOOST_NOEXCEPT
+{
+    unsigned char const * q = p;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        std::size_t k = load_leb128_u64( q, end, dst[ i ] );
+
+        if( k == 0 ) return 0;
+
+        q += k;
+    }
+
+    return static_cast<std::size_t>( q - p );
+}
+
+// prefix varint
+//
+// store_prefix_varint_u64: p must have room for 9 bytes.
+// Returns: the number of bytes written.
+
+inline std::size_t store_prefix_varint_u64( unsigned char * p, std::uint64_t v ) BOOST_NOEXCEPT
+{
+    unsigned bits = 1;
+
+    for( std::uint64_t t = v >> 1; t != 0; t >>= 1 ) ++bits;
+
+    if( bits > 56 )
+    {
+        p[ 0 ] = 0;
+        boost::endian::endian_store<std::uint64_t, 8, order::little>( p + 1, v );
+        return 9;
+    }
+
+    std::size_t n = ( bits + 6 ) / 7;
+
+    std::uint64_t w = ( ( v << 1 ) | 1 ) << ( n - 1 );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        p[ i ] = static_cast<unsigned char>( w >> ( i * 8 ) );
+    }
+
+    return n;
+}
+
+inline std::size_t load_prefix_varint_u64( unsigned char const * p, unsigned char const * end, std::uint64_t & v ) BOOST_NOEXCEPT
+{
+    if( p == end ) return 0;
+
+    if( p[ 0 ] == 0 )
+    {
+        if( end - p < 9 ) return 0;
+
+        v = boost::endian::endian_load<std::uint64_t, 8, order::little>( p + 1 );
+        return 9;
+    }
+
+    std::size_t n = detail::varint_ctz64( p[ 0 ] ) + 1;
+
+    if( end - p < static_cast<std::ptrdiff_t>( n ) ) return 0;
+
+    std::uint64_t w = 0;
+
+    if( end - p >= 8 )
+    {
+        w = boost::endian::endian_load<std::uint64_t, 8, order::little>( p );
+        w &= n == 8? ~std::uint64_t( 0 ): ( std::uint64_t( 1 ) << ( n * 8 ) ) - 1;
+    }
+    else
+    {
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            w |= static_cast<std::uint64_t>( p[ i ] ) << ( i * 8 );
+        }
+    }
+
+    v = w >> n;
+    return n;
+}
+
+// Stream VByte
+//
+// Layout: ( n + 3 ) / 4 control bytes, followed by the data bytes. Value i
+// is described by bits 2 * ( i % 4 ) of control byte i / 4, which hold its
+// length minus one. The bytes of each value are stored in the given order.
+
+inline std::size_t streamvbyte_max_size( std::size_t n ) BOOST_NOEXCEPT
+{
+    return ( n + 3 ) / 4 + n * 4;
+}
+
+namespace detail
+{
+
+inline std::size_t streamvbyte_length( std::uint32_t v ) BOOST_NOEXCEPT
+{
+    return v < 0x100u? 1: v < 0x10000u? 2: v < 0x1000000u? 3: 4;
+}
+
+inline std::size_t streamvbyte_block_length( unsigned c ) BOOST_NOEXCEPT
+{
+    return ( c & 3 ) + ( ( c >> 2 ) & 3 ) + ( ( c >> 4 ) & 3 ) + ( c >> 6 ) + 4;
+}
+
+template<order Order> inline void streamvbyte_store( unsigned char * p, std::uint32_t v, std::size_t n ) BOOST_NOEXCEPT
+{
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        std::size_t s = Order == order::little? i: n - 1 - i;
+        p[ i ] = static_cast<unsigned char>( v >> ( s * 8 ) );
+    }
+}
+
+template<order Order> inline std::uint32_t streamvbyte_load( unsigned char const * p, std::size_t n ) BOOST_NOEXCEPT
+{
+    std::uint32_t v = 0;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        std::size_t s = Order == order::little? i: n - 1 - i;
+        v |= static_cast<std::uint32_t>( p[ i ] ) << ( s * 8 );
+    }
+
+    return v;
+}
+
+#if defined(BOOST_ENDIAN_VARINT_SSSE3)
+
+// shuffle masks moving the data bytes of a block into four native 32-bit lanes
+
+template<order Order> struct streamvbyte_shuffle_table
+{
+    unsigned char mask[ 256 ][ 16 ];
+
+    streamvbyte_shuffle_table() BOOST_NOEXCEPT
+    {
+        for( unsigned c = 0; c < 256; ++c )
+        {
+            unsigned char k = 0;
+
+            for( unsigned j = 0; j < 4; ++j )
+            {
+                unsigned n = ( ( c >> ( 2 * j ) ) & 3 ) + 1;
+
+                for( unsigned i = 0; i < 4; ++i )
+                {
+                    // little: lane byte i is data byte i; big: data byte n - 1 - i
+                    unsigned char s = static_cast<unsigned char>( Order == order::little? k + i: k + n - 1 - i );
+                    mask[ c ][ j * 4 + i ] = i < n? s: 0x80;
+                }
+
+                k = static_cast<unsigned char>( k + n );
+            }
+        }
+    }
+
+    static streamvbyte_shuffle_table const & get() BOOST_NOEXCEPT
+    {
+        static const streamvbyte_shuffle_table t;
+        return t;
+    }
+};
+
+#endif
+
+} // namespace detail
+
+// Requires: out has room for streamvbyte_max_size( n ) bytes
+// Returns: the number of bytes written
+
+template<order Order>
+inline std::size_t streamvbyte_encode( unsigned char * out, std::uint32_t const * in, std::size_t n ) BOOST_NOEXCEPT
+{
+    unsigned char * ctrl = out;
+    unsigned char * data = out + ( n + 3 ) / 4;
+
+    for( std::size_t i = 0; i < n; i += 4 )
+    {
+        unsigned c = 0;
+
+        for( std::size_t j = 0; j < 4 && i + j < n; ++j )
+        {
+            std::uint32_t v = in[ i + j ];
+            std::size_t k = detail::streamvbyte_length( v );
+
+            detail::streamvbyte_store<Order>( data, v, k );
+            data += k;
+
+            c |= static_cast<unsigned>( k - 1 ) << ( 2 * j );
+        }
+
+        *ctrl++ = static_cast<unsigned char>( c );
+    }
+
+    return static_cast<std::size_t>( data - out );
+}
+
+// Decodes n values from the size bytes at in.
+// Returns: the number of bytes consumed, or 0 if the input is too short
+
+template<order Order>
+inline std::size_t streamvbyte_decode( std::uint32_t * out, unsigned char const * in, std::size_t size, std::size_t n ) BOOST_NOEXCEPT
+{
+    std::size_t const nc = ( n + 3 ) / 4;
+
+    if( size < nc ) return 0;
+
+    unsigned char const * ctrl = in;
+    unsigned char const * data = in + nc;
+    unsigned char const * end = in + size;
+
+    // validate the total length up front, so that the loops need no checks
+
+    {
+        std::size_t total = 0;
+
+        for( std::size_t i = 0; i < n / 4; ++i )
+        {
+            total += detail::streamvbyte_block_length( ctrl[ i ] );
+        }
+
+        for( std::size_t j = 0; j < n % 4; ++j )
+        {
+            total += ( ( ctrl[ n / 4 ] >> ( 2 * j ) ) & 3 ) + 1;
+        }
+
+        if( static_cast<std::size_t>( end - data ) < total ) return 0;
+    }
+
+    std::size_t i = 0;
+
+#if defined(BOOST_ENDIAN_VARINT_SSSE3)
+
+    detail::streamvbyte_shuffle_table<Order> const & t = detail::streamvbyte_shuffle_table<Order>::get();
+
+    // a block reads 16 bytes, whatever its length
+
+    for( ; i + 4 <= n && end - data >= 16; i += 4 )
+    {
+        unsigned c = *ctrl++;
+
+        __m128i d = _mm_loadu_si128( reinterpret_cast<__m128i const*>( data ) );
+        __m128i m = _mm_loadu_si128( reinterpret_cast<__m128i const*>( t.mask[ c ] ) );
+
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( out + i ), _mm_shuffle_epi8( d, m ) );
+
+        data += detail::streamvbyte_block_length( c );
+    }
+
+#endif
+
+    for( ; i < n; i += 4 )
+    {
+        unsigned c = *ctrl++;
+
+        for( std::size_t j = 0; j < 4 && i + j < n; ++j )
+        {
+            std::size_t k = ( ( c >> ( 2 * j ) ) & 3 ) + 1;
+
+            out[ i + j ] = detail::streamvbyte_load<Order>( data, k );
+            data += k;
+        }
+    }
+
+    return static_cast<std::size_t>( data - in );
+}
+
+} // namespace endian
+} // namespace boost
+
+#endif  // BOOST_ENDIAN_VARINT_HPP_INCLUDED
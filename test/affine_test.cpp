@@ -0,0 +1,72 @@
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/affine.hpp>
+#include <boost/endian/buffers.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+
+template<class T, std::size_t N, boost::endian::order Order, class D> void test( D scale, D offset )
+{
+    using namespace boost::endian;
+
+    std::size_t const n = 37;
+
+    unsigned char src[ n * N ];
+    T values[ n ];
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        values[ i ] = static_cast<T>( static_cast<int>( i * 7 ) - 100 );
+        endian_store<T, N, Order>( src + i * N, values[ i ] );
+    }
+
+    D dst[ n ];
+
+    endian_affine<T, N, Order>( dst, src, n, scale, offset );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        BOOST_TEST_EQ( dst[ i ], static_cast<D>( values[ i ] ) * scale + offset );
+    }
+}
+
+int main()
+{
+    using namespace boost::endian;
+
+    test<std::int16_t, 2, order::big>( 1.0f, 32768.0f );
+    test<std::int16_t, 2, order::little>( 0.5, -1.0 );
+    test<std::uint8_t, 1, order::big>( 2.0f, 0.0f );
+    test<std::int32_t, 4, order::big>( 0.25, 1.0e9 );
+    test<std::int32_t, 3, order::little>( 1.5f, 1.0f );
+    test<std::int64_t, 8, order::big>( 1.0, 0.0 );
+    test<float, 4, order::big>( 2.0f, 1.0f );
+    test<double, 8, order::big>( 3.0, -0.5 );
+    test<float, 4, order::little>( 2.0, 1.0 );
+
+    // BLANK
+
+    {
+        big_int16_buf_t const src[] = { big_int16_buf_t( 1 ), big_int16_buf_t( -32768 ), big_int16_buf_t( 3 ) };
+
+        double dst[ 3 ];
+
+        endian_affine( dst, src, 3, 2.0, 10.0, std::int16_t( -32768 ) );
+
+        BOOST_TEST_EQ( dst[ 0 ], 12.0 );
+        BOOST_TEST( dst[ 1 ] != dst[ 1 ] );
+        BOOST_TEST_EQ( dst[ 2 ], 16.0 );
+
+        float f[ 3 ];
+
+        endian_affine( f, src, 3, 1.0f, 32768.0f );
+
+        BOOST_TEST_EQ( f[ 0 ], 32769.0f );
+        BOOST_TEST_EQ( f[ 1 ], 0.0f );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,116 @@
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/bitfield.hpp>
+#include <boost/endian/buffers.hpp>
+#include <boost/endian/arithmetic.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+
+// compares against a full load, shift and mask
+
+template<boost::endian::order Order, unsigned Offset, unsigned Width> void test_field()
+{
+    using namespace boost::endian;
+
+    typedef endian_bitfield<Order, std::uint32_t, Offset, Width> field;
+
+    std::uint32_t const mask = static_cast<std::uint32_t>( 0xFFFFFFFFu >> ( 32 - Width ) );
+
+    unsigned char p[ 4 ] = { 0x12, 0x9A, 0xC5, 0x7E };
+
+    std::uint32_t w = endian_load<std::uint32_t, 4, Order>( p );
+
+    BOOST_TEST_EQ( field::get( p ), ( w >> Offset ) & mask );
+
+    field::set( p, 0xA5A5A5A5u );
+
+    std::uint32_t const expected = ( w & ~( mask << Offset ) ) | ( ( 0xA5A5A5A5u & mask ) << Offset );
+
+    BOOST_TEST_EQ( ( endian_load<std::uint32_t, 4, Order>( p ) ), expected );
+    BOOST_TEST_EQ( field::get( p ), 0xA5A5A5A5u & mask );
+}
+
+template<boost::endian::order Order> void test_fields()
+{
+    test_field<Order, 0, 1>();
+    test_field<Order, 3, 4>();
+    test_field<Order, 4, 4>();
+    test_field<Order, 7, 2>();
+    test_field<Order, 5, 13>();
+    test_field<Order, 8, 16>();
+    test_field<Order, 0, 32>();
+    test_field<Order, 31, 1>();
+    test_field<Order, 1, 30>();
+}
+
+int main()
+{
+    using namespace boost::endian;
+
+    test_fields<order::big>();
+    test_fields<order::little>();
+
+    // IPv4
+
+    {
+        unsigned char header[] = { 0x45, 0x00, 0x00, 0x54, 0x12, 0x34, 0x40, 0x00 };
+
+        typedef endian_bitfield<order::big, std::uint8_t, 4, 4> version;
+        typedef endian_bitfield<order::big, std::uint8_t, 0, 4> ihl;
+        typedef endian_bitfield<order::big, std::uint16_t, 13, 3> flags;
+        typedef endian_bitfield<order::big, std::uint16_t, 0, 13> fragment_offset;
+
+        BOOST_TEST_EQ( version::get( header ), 4 );
+        BOOST_TEST_EQ( ihl::get( header ), 5 );
+        BOOST_TEST_EQ( flags::get( header + 6 ), 2 );
+        BOOST_TEST_EQ( fragment_offset::get( header + 6 ), 0 );
+
+        fragment_offset::set( header + 6, 0x1ABC );
+
+        BOOST_TEST_EQ( header[ 6 ], 0x5A );
+        BOOST_TEST_EQ( header[ 7 ], 0xBC );
+        BOOST_TEST_EQ( flags::get( header + 6 ), 2 );
+
+        ihl::set( header, 6 );
+
+        BOOST_TEST_EQ( header[ 0 ], 0x46 );
+    }
+
+    // buffers and arithmetic types
+
+    {
+        big_uint16_buf_t b( 0x4000 );
+
+        typedef endian_bitfield<order::big, std::uint16_t, 14, 1> dont_fragment;
+
+        BOOST_TEST_EQ( dont_fragment::get( b ), 1 );
+
+        dont_fragment::set( b, 0 );
+        BOOST_TEST_EQ( b.value(), 0 );
+
+        little_uint32_at a( 0x12345678 );
+
+        typedef endian_bitfield<order::little, std::uint32_t, 8, 12> field;
+
+        BOOST_TEST_EQ( field::get( a ), 0x456u );
+
+        field::set( a, 0xFFF );
+        BOOST_TEST_EQ( a, 0x123FFF78u );
+    }
+
+    // 64-bit word, 5-byte field
+
+    {
+        unsigned char p[ 8 ] = {};
+
+        typedef endian_bitfield<order::big, std::uint64_t, 3, 36> field;
+
+        field::set( p, 0xFFFFFFFFFFFFFFFFull );
+
+        BOOST_TEST_EQ( ( endian_load<std::uint64_t, 8, order::big>( p ) ), 0x7FFFFFFFF8ull );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,205 @@
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/bitpack.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+
+template<boost::endian::order Order> void test_roundtrip()
+{
+    using namespace boost::endian;
+
+    std::size_t const n = 37;
+
+    std::uint32_t src[ n ];
+
+    std::uint32_t x = 0x12345678;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        x = x * 1664525u + 1013904223u;
+        src[ i ] = x;
+    }
+
+    for( unsigned bits = 0; bits <= 32; ++bits )
+    {
+        std::uint32_t const mask = bits == 32? 0xFFFFFFFFu: ( 1u << bits ) - 1;
+
+        unsigned char packed[ n * 4 + 4 ];
+
+        for( std::size_t i = 0; i < sizeof( packed ); ++i ) packed[ i ] = 0xCC;
+
+        std::size_t const size = packed_size( n, bits );
+
+        pack_bits<Order>( packed, src, n, bits );
+
+        // nothing written past the packed size
+
+        for( std::size_t i = size; i < sizeof( packed ); ++i )
+        {
+            BOOST_TEST_EQ( packed[ i ], 0xCC );
+        }
+
+        std::uint32_t dst[ n ];
+
+        unpack_bits<Order>( dst, packed, n, bits );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            BOOST_TEST_EQ( dst[ i ], src[ i ] & mask );
+        }
+    }
+}
+
+// the byte-granular sample layout is a prefix of the word-padded big endian one
+
+template<unsigned Bits> void test_msb()
+{
+    using namespace boost::endian;
+
+    for( std::size_t n = 0; n <= 13; ++n )
+    {
+        std::uint16_t src[ 13 ];
+        std::uint32_t src32[ 13 ];
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            src[ i ] = static_cast<std::uint16_t>( ( i + 1 ) * 40503u );
+            src32[ i ] = src[ i ];
+        }
+
+        unsigned char expected[ 32 ] = {};
+        pack_bits<order::big>( expected, src32, n, Bits );
+
+        unsigned char packed[ 32 ];
+
+        for( int i = 0; i < 32; ++i ) packed[ i ] = 0xEE;
+
+        pack_msb<Bits>( packed, src, n );
+
+        std::size_t const size = packed_msb_size( n, Bits );
+
+        for( std::size_t i = 0; i < size; ++i )
+        {
+            BOOST_TEST_EQ( packed[ i ], expected[ i ] );
+        }
+
+        BOOST_TEST_EQ( packed[ size ], 0xEE );
+
+        std::uint16_t out[ 13 ];
+
+        unpack_msb<Bits>( out, packed, n );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            BOOST_TEST_EQ( out[ i ], src[ i ] & ( ( 1u << Bits ) - 1 ) );
+        }
+    }
+}
+
+int main()
+{
+    using namespace boost::endian;
+
+    test_roundtrip<order::little>();
+    test_roundtrip<order::big>();
+
+    BOOST_TEST_EQ( packed_size( 0, 7 ), 0u );
+    BOOST_TEST_EQ( packed_size( 1, 7 ), 4u );
+    BOOST_TEST_EQ( packed_size( 32, 1 ), 4u );
+    BOOST_TEST_EQ( packed_size( 33, 1 ), 8u );
+    BOOST_TEST_EQ( packed_size( 3, 32 ), 12u );
+
+    // layout
+
+    {
+        std::uint32_t const src[] = { 0xABC, 0xDEF, 0x123 };
+
+        unsigned char packed[ 8 ];
+
+        pack_bits<order::big>( packed, src, 3, 12 );
+
+        BOOST_TEST_EQ( packed[ 0 ], 0xAB );
+        BOOST_TEST_EQ( packed[ 1 ], 0xCD );
+        BOOST_TEST_EQ( packed[ 2 ], 0xEF );
+        BOOST_TEST_EQ( packed[ 3 ], 0x12 );
+        BOOST_TEST_EQ( packed[ 4 ], 0x30 );
+        BOOST_TEST_EQ( packed[ 5 ], 0x00 );
+
+        pack_bits<order::little>( packed, src, 3, 12 );
+
+        BOOST_TEST_EQ( packed[ 0 ], 0xBC );
+        BOOST_TEST_EQ( packed[ 1 ], 0xFA );
+        BOOST_TEST_EQ( packed[ 2 ], 0xDE );
+        BOOST_TEST_EQ( packed[ 3 ], 0x23 );
+        BOOST_TEST_EQ( packed[ 4 ], 0x01 );
+        BOOST_TEST_EQ( packed[ 5 ], 0x00 );
+    }
+
+    {
+        std::uint32_t const src[] = { 1, 0, 1, 1, 0, 0, 0, 1, 1 };
+
+        unsigned char packed[ 4 ];
+
+        pack_bits<order::big>( packed, src, 9, 1 );
+
+        BOOST_TEST_EQ( packed[ 0 ], 0xB1 );
+        BOOST_TEST_EQ( packed[ 1 ], 0x80 );
+
+        pack_bits<order::little>( packed, src, 9, 1 );
+
+        BOOST_TEST_EQ( packed[ 0 ], 0x8D );
+        BOOST_TEST_EQ( packed[ 1 ], 0x01 );
+    }
+
+    // packed samples
+
+    test_msb<2>();
+    test_msb<10>();
+    test_msb<12>();
+    test_msb<14>();
+    test_msb<16>();
+
+    {
+        std::uint16_t const src[] = { 0xABC, 0x123, 0xFFF };
+
+        unsigned char packed[ 5 ];
+
+        pack_msb12( packed, src, 3 );
+
+        BOOST_TEST_EQ( packed[ 0 ], 0xAB );
+        BOOST_TEST_EQ( packed[ 1 ], 0xC1 );
+        BOOST_TEST_EQ( packed[ 2 ], 0x23 );
+        BOOST_TEST_EQ( packed[ 3 ], 0xFF );
+        BOOST_TEST_EQ( packed[ 4 ], 0xF0 );
+
+        std::uint16_t out[ 3 ];
+
+        unpack_msb12( out, packed, 3 );
+
+        BOOST_TEST_EQ( out[ 0 ], 0xABC );
+        BOOST_TEST_EQ( out[ 1 ], 0x123 );
+        BOOST_TEST_EQ( out[ 2 ], 0xFFF );
+
+        std::uint16_t const src10[] = { 0x3FF, 0, 0x3FF, 0 };
+
+        pack_msb10( packed, src10, 4 );
+
+        BOOST_TEST_EQ( packed[ 0 ], 0xFF );
+        BOOST_TEST_EQ( packed[ 1 ], 0xC0 );
+        BOOST_TEST_EQ( packed[ 2 ], 0x0F );
+        BOOST_TEST_EQ( packed[ 3 ], 0xFC );
+        BOOST_TEST_EQ( packed[ 4 ], 0x00 );
+
+        std::uint16_t const src14[] = { 0x2AAA };
+
+        pack_msb14( packed, src14, 1 );
+        unpack_msb14( out, packed, 1 );
+
+        BOOST_TEST_EQ( out[ 0 ], 0x2AAA );
+    }
+
+    return boost::report_errors();
+}
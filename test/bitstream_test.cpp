@@ -0,0 +1,200 @@
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/bitstream.hpp>
+#include <boost/endian/bitpack.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+
+template<boost::endian::order Order> void test_roundtrip()
+{
+    using namespace boost::endian;
+
+    std::size_t const n = 200;
+
+    std::uint64_t values[ n ];
+    unsigned widths[ n ];
+
+    std::uint64_t x = 0x0123456789ABCDEFull;
+    std::size_t total = 0;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        x = x * 6364136223846793005ull + 1442695040888963407ull;
+
+        widths[ i ] = static_cast<unsigned>( ( x >> 58 ) % 57 );
+        values[ i ] = ( x >> 3 ) & ( ( std::uint64_t( 1 ) << widths[ i ] ) - 1 );
+
+        total += widths[ i ];
+    }
+
+    unsigned char buffer[ n * 8 + 8 ];
+
+    bit_writer<Order> w( buffer, sizeof( buffer ) );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        w.write( values[ i ], widths[ i ] );
+    }
+
+    BOOST_TEST_EQ( w.position(), total );
+
+    std::size_t size = w.finish();
+
+    BOOST_TEST_EQ( size, ( total + 7 ) / 8 );
+    BOOST_TEST( !w.overflow() );
+
+    for( std::size_t slack = 0; slack <= 8; slack += 8 )
+    {
+        bit_reader<Order> r( buffer, size, slack );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            BOOST_TEST_EQ( r.read( widths[ i ] ), values[ i ] );
+        }
+
+        BOOST_TEST_EQ( r.position(), total );
+        BOOST_TEST( !r.overrun() );
+
+        r.read( 8 );
+        BOOST_TEST( r.overrun() );
+    }
+}
+
+int main()
+{
+    using namespace boost::endian;
+
+    test_roundtrip<order::big>();
+    test_roundtrip<order::little>();
+
+    // bit order
+
+    {
+        unsigned char buffer[ 2 ] = { 0, 0 };
+
+        bit_writer<order::big> w( buffer, 2 );
+
+        w.write( 5, 3 );
+        w.write( 0x1F, 5 );
+        w.write( 1, 1 );
+
+        BOOST_TEST_EQ( w.finish(), 2u );
+
+        BOOST_TEST_EQ( buffer[ 0 ], 0xBF );
+        BOOST_TEST_EQ( buffer[ 1 ], 0x80 );
+
+        bit_reader<order::big> r( buffer, 2 );
+
+        BOOST_TEST_EQ( r.read( 4 ), 0xBu );
+        BOOST_TEST_EQ( r.read( 12 ), 0xF80u );
+        BOOST_TEST( !r.overrun() );
+        BOOST_TEST_EQ( r.read( 0 ), 0u );
+    }
+
+    {
+        unsigned char buffer[ 2 ] = { 0, 0 };
+
+        bit_writer<order::little> w( buffer, 2 );
+
+        w.write( 5, 3 );
+        w.write( 0x1F, 5 );
+        w.write( 1, 1 );
+
+        BOOST_TEST_EQ( w.finish(), 2u );
+
+        BOOST_TEST_EQ( buffer[ 0 ], 0xFD );
+        BOOST_TEST_EQ( buffer[ 1 ], 0x01 );
+
+        bit_reader<order::little> r( buffer, 2 );
+
+        BOOST_TEST_EQ( r.read( 4 ), 0xDu );
+        BOOST_TEST_EQ( r.read( 12 ), 0x01Fu );
+    }
+
+    // alignment
+
+    {
+        unsigned char const buffer[] = { 0xA5, 0x3C };
+
+        bit_reader<order::big> r( buffer, 2 );
+
+        BOOST_TEST_EQ( r.read( 3 ), 5u );
+        r.align_to_byte();
+        BOOST_TEST_EQ( r.position(), 8u );
+        BOOST_TEST_EQ( r.read( 8 ), 0x3Cu );
+    }
+
+    // read_n agrees with unpack_bits
+
+    {
+        std::uint32_t src[ 100 ];
+
+        for( std::uint32_t i = 0; i < 100; ++i ) src[ i ] = i * 2654435761u;
+
+        for( unsigned bits = 0; bits <= 32; bits += 5 )
+        {
+            unsigned char packed[ 400 ];
+
+            pack_bits<order::big>( packed, src, 100, bits );
+
+            std::uint32_t a[ 100 ], b[ 100 ];
+
+            unpack_bits<order::big>( a, packed, 100, bits );
+
+            bit_reader<order::big> r( packed, packed_size( 100, bits ) );
+            r.read_n( b, 100, bits );
+
+            for( int i = 0; i < 100; ++i )
+            {
+                BOOST_TEST_EQ( a[ i ], b[ i ] );
+            }
+
+            pack_bits<order::little>( packed, src, 100, bits );
+            unpack_bits<order::little>( a, packed, 100, bits );
+
+            bit_reader<order::little> r2( packed, packed_size( 100, bits ) );
+            r2.read_n( b, 100, bits );
+
+            for( int i = 0; i < 100; ++i )
+            {
+                BOOST_TEST_EQ( a[ i ], b[ i ] );
+            }
+        }
+    }
+
+    // write_n
+
+    {
+        std::uint32_t const src[] = { 1, 2, 3, 4, 5, 6, 7 };
+
+        unsigned char buffer[ 4 ];
+
+        bit_writer<order::big> w( buffer, 4 );
+        w.write_n( src, 7, 4 );
+
+        BOOST_TEST_EQ( w.finish(), 4u );
+
+        BOOST_TEST_EQ( buffer[ 0 ], 0x12 );
+        BOOST_TEST_EQ( buffer[ 1 ], 0x34 );
+        BOOST_TEST_EQ( buffer[ 2 ], 0x56 );
+        BOOST_TEST_EQ( buffer[ 3 ], 0x70 );
+    }
+
+    // overflow
+
+    {
+        unsigned char buffer[ 3 ];
+
+        bit_writer<order::little> w( buffer, 3 );
+
+        w.write( 0xFFFFFFFF, 32 );
+
+        BOOST_TEST_EQ( w.finish(), 3u );
+        BOOST_TEST( w.overflow() );
+    }
+
+    return boost::report_errors();
+}
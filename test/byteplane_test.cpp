@@ -0,0 +1,118 @@
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/byteplane.hpp>
+#include <boost/endian/buffers.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+template<std::size_t W> void test()
+{
+    using namespace boost::endian;
+
+    std::size_t const n = 13;
+
+    unsigned char big[ n * W ];
+    unsigned char little[ n * W ];
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        for( std::size_t k = 0; k < W; ++k )
+        {
+            unsigned char b = static_cast<unsigned char>( i * 16 + k );
+
+            big[ i * W + W - 1 - k ] = b;
+            little[ i * W + k ] = b;
+        }
+    }
+
+    unsigned char planes[ n * W ];
+
+    byteplane_split<order::big, W>( planes, big, n );
+
+    for( std::size_t k = 0; k < W; ++k )
+    {
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            BOOST_TEST_EQ( planes[ k * n + i ], i * 16 + k );
+        }
+    }
+
+    {
+        unsigned char planes2[ n * W ];
+
+        byteplane_split<order::little, W>( planes2, little, n );
+        BOOST_TEST( std::memcmp( planes, planes2, n * W ) == 0 );
+    }
+
+    unsigned char out[ n * W ];
+
+    byteplane_merge<order::big, W>( out, planes, n );
+    BOOST_TEST( std::memcmp( out, big, n * W ) == 0 );
+
+    byteplane_merge<order::little, W>( out, planes, n );
+    BOOST_TEST( std::memcmp( out, little, n * W ) == 0 );
+}
+
+int main()
+{
+    using namespace boost::endian;
+
+    test<1>();
+    test<2>();
+    test<3>();
+    test<4>();
+    test<5>();
+    test<6>();
+    test<7>();
+    test<8>();
+
+    // big endian buffers to little endian buffers through the planes
+
+    {
+        big_uint32_buf_t v[ 5 ];
+
+        for( int i = 0; i < 5; ++i ) v[ i ] = 0x01020304u * ( i + 1 );
+
+        unsigned char planes[ 20 ];
+        byteplane_split( planes, v, 5 );
+
+        little_uint32_buf_t w[ 5 ];
+        byteplane_merge( w, planes, 5 );
+
+        for( int i = 0; i < 5; ++i )
+        {
+            BOOST_TEST_EQ( w[ i ].value(), v[ i ].value() );
+        }
+    }
+
+    {
+        little_int24_buf_t v[ 3 ];
+
+        v[ 0 ] = -1;
+        v[ 1 ] = 0x123456;
+        v[ 2 ] = -0x800000;
+
+        unsigned char planes[ 9 ];
+        byteplane_split( planes, v, 3 );
+
+        BOOST_TEST_EQ( planes[ 0 ], 0xFF );
+        BOOST_TEST_EQ( planes[ 1 ], 0x56 );
+        BOOST_TEST_EQ( planes[ 2 ], 0x00 );
+        BOOST_TEST_EQ( planes[ 6 ], 0xFF );
+        BOOST_TEST_EQ( planes[ 7 ], 0x12 );
+        BOOST_TEST_EQ( planes[ 8 ], 0x80 );
+
+        big_int24_buf_t w[ 3 ];
+        byteplane_merge( w, planes, 3 );
+
+        BOOST_TEST_EQ( w[ 0 ].value(), -1 );
+        BOOST_TEST_EQ( w[ 1 ].value(), 0x123456 );
+        BOOST_TEST_EQ( w[ 2 ].value(), -0x800000 );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,207 @@
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/codec.hpp>
+#include <boost/endian/buffers.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+template<class T, std::size_t N, boost::endian::order Order> void test_delta( T const * x, std::size_t n )
+{
+    using namespace boost::endian;
+
+    typedef typename std::make_unsigned<T>::type U;
+
+    unsigned char src[ 16 * N ] = {};
+    unsigned char enc[ 16 * N ] = {};
+    unsigned char dec[ 16 * N ] = {};
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        endian_store<T, N, Order>( src + i * N, x[ i ] );
+    }
+
+    BOOST_TEST_EQ( (endian_delta_encode<T, N, Order>( enc, src, n )), x[ n - 1 ] );
+
+    BOOST_TEST_EQ( (endian_load<T, N, Order>( enc )), x[ 0 ] );
+
+    for( std::size_t i = 1; i < n; ++i )
+    {
+        unsigned char tmp[ N ];
+        endian_store<U, N, Order>( tmp, static_cast<U>( static_cast<U>( x[ i ] ) - static_cast<U>( x[ i - 1 ] ) ) );
+
+        BOOST_TEST( std::memcmp( tmp, enc + i * N, N ) == 0 );
+    }
+
+    BOOST_TEST_EQ( (endian_delta_decode<T, N, Order>( dec, enc, n )), x[ n - 1 ] );
+    BOOST_TEST( std::memcmp( src, dec, n * N ) == 0 );
+
+    // in place, in two blocks
+
+    std::size_t const k = n / 2;
+
+    T prev = endian_delta_encode<T, N, Order>( src, src, k );
+    endian_delta_encode<T, N, Order>( src + k * N, src + k * N, n - k, prev );
+
+    BOOST_TEST( std::memcmp( src, enc, n * N ) == 0 );
+
+    prev = endian_delta_decode<T, N, Order>( src, src, k );
+    endian_delta_decode<T, N, Order>( src + k * N, src + k * N, n - k, prev );
+
+    BOOST_TEST( std::memcmp( src, dec, n * N ) == 0 );
+
+    // frame of reference
+
+    endian_frame<T> f = endian_for_encode<T, N, Order>( enc, dec, n );
+
+    T lo = x[ 0 ], hi = x[ 0 ];
+
+    for( std::size_t i = 1; i < n; ++i )
+    {
+        if( x[ i ] < lo ) lo = x[ i ];
+        if( hi < x[ i ] ) hi = x[ i ];
+    }
+
+    BOOST_TEST_EQ( f.reference, lo );
+    BOOST_TEST_EQ( f.range, static_cast<U>( static_cast<U>( hi ) - static_cast<U>( lo ) ) );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        unsigned char tmp[ N ];
+        endian_store<U, N, Order>( tmp, static_cast<U>( static_cast<U>( x[ i ] ) - static_cast<U>( lo ) ) );
+
+        BOOST_TEST( std::memcmp( tmp, enc + i * N, N ) == 0 );
+    }
+
+    endian_for_decode<T, N, Order>( enc, enc, n, f.reference );
+    BOOST_TEST( std::memcmp( enc, dec, n * N ) == 0 );
+}
+
+int main()
+{
+    using namespace boost::endian;
+
+    {
+        std::int32_t const x[] = { 1000, 1003, 1001, 998, 2000, -5, 0x7FFFFF, -0x800000, 17, 17 };
+
+        test_delta<std::int32_t, 4, order::big>( x, 10 );
+        test_delta<std::int32_t, 4, order::little>( x, 10 );
+        test_delta<std::int32_t, 3, order::big>( x, 10 );
+        test_delta<std::int32_t, 3, order::little>( x, 10 );
+    }
+
+    {
+        std::int64_t const x[] = { -1, 0x7FFFFFFFFFFFFFFFll, -0x7FFFFFFFFFFFFFFFll - 1, 5, 6, 7, 1000000000000ll };
+
+        test_delta<std::int64_t, 8, order::big>( x, 7 );
+        test_delta<std::int64_t, 8, order::little>( x, 7 );
+    }
+
+    {
+        std::uint16_t const x[] = { 65535, 0, 1, 65534, 100, 200, 300 };
+
+        test_delta<std::uint16_t, 2, order::big>( x, 7 );
+        test_delta<std::uint16_t, 2, order::little>( x, 7 );
+    }
+
+    // buffers
+
+    {
+        big_int32_buf_t v[ 4 ], d[ 4 ];
+
+        v[ 0 ] = 10; v[ 1 ] = 12; v[ 2 ] = 9; v[ 3 ] = 9;
+
+        BOOST_TEST_EQ( endian_delta_encode( d, v, 4 ), 9 );
+
+        BOOST_TEST_EQ( d[ 0 ].value(), 10 );
+        BOOST_TEST_EQ( d[ 1 ].value(), 2 );
+        BOOST_TEST_EQ( d[ 2 ].value(), -3 );
+        BOOST_TEST_EQ( d[ 3 ].value(), 0 );
+
+        BOOST_TEST_EQ( endian_delta_decode( d, d, 4 ), 9 );
+
+        BOOST_TEST_EQ( d[ 2 ].value(), 9 );
+
+        endian_frame<std::int_least32_t> f = endian_for_encode( d, v, 4 );
+
+        BOOST_TEST_EQ( f.reference, 9 );
+        BOOST_TEST_EQ( f.range, 3u );
+        BOOST_TEST_EQ( d[ 1 ].value(), 3 );
+
+        endian_for_decode( d, d, 4, f.reference );
+
+        BOOST_TEST_EQ( d[ 1 ].value(), 12 );
+    }
+
+    {
+        little_int64_buf_t v[ 3 ], d[ 3 ];
+
+        v[ 0 ] = -100; v[ 1 ] = -50; v[ 2 ] = 0;
+
+        endian_delta_encode( d, v, 3 );
+
+        BOOST_TEST_EQ( d[ 0 ].value(), -100 );
+        BOOST_TEST_EQ( d[ 1 ].value(), 50 );
+        BOOST_TEST_EQ( d[ 2 ].value(), 50 );
+    }
+
+    // run length
+
+    {
+        big_uint16_buf_t v[ 9 ];
+
+        std::uint16_t const x[] = { 7, 7, 7, 1, 2, 2, 7, 7, 7 };
+
+        for( int i = 0; i < 9; ++i ) v[ i ] = x[ i ];
+
+        big_uint16_buf_t values[ 9 ];
+        std::uint32_t lengths[ 9 ];
+
+        std::size_t runs = endian_rle_encode( values, lengths, v, 9 );
+
+        BOOST_TEST_EQ( runs, 4u );
+
+        BOOST_TEST_EQ( values[ 0 ].value(), 7 );
+        BOOST_TEST_EQ( lengths[ 0 ], 3u );
+        BOOST_TEST_EQ( values[ 1 ].value(), 1 );
+        BOOST_TEST_EQ( lengths[ 1 ], 1u );
+        BOOST_TEST_EQ( values[ 2 ].value(), 2 );
+        BOOST_TEST_EQ( lengths[ 2 ], 2u );
+        BOOST_TEST_EQ( values[ 3 ].value(), 7 );
+        BOOST_TEST_EQ( lengths[ 3 ], 3u );
+
+        std::uint_least16_t y[ 9 ];
+
+        BOOST_TEST_EQ( endian_rle_decode( y, values, lengths, runs ), 9u );
+
+        for( int i = 0; i < 9; ++i )
+        {
+            BOOST_TEST_EQ( y[ i ], x[ i ] );
+        }
+
+        BOOST_TEST_EQ( endian_rle_encode( values, lengths, v, 0 ), 0u );
+    }
+
+    {
+        unsigned char const v[] = { 1, 0, 0, 1, 0, 0, 2, 0, 0 };
+
+        unsigned char values[ 9 ];
+        std::uint32_t lengths[ 3 ];
+
+        BOOST_TEST_EQ( endian_rle_encode<3>( values, lengths, v, 3 ), 2u );
+
+        std::int32_t y[ 3 ];
+
+        BOOST_TEST_EQ( (endian_rle_decode<std::int32_t, 3, order::little>( y, values, lengths, 2 )), 3u );
+
+        BOOST_TEST_EQ( y[ 0 ], 1 );
+        BOOST_TEST_EQ( y[ 1 ], 1 );
+        BOOST_TEST_EQ( y[ 2 ], 2 );
+    }
+
+    return boost::report_errors();
+}
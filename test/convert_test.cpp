@@ -0,0 +1,239 @@
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/convert.hpp>
+#include <boost/endian/buffers.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+// compares against endian_load followed by a cast, for all array lengths
+// around the point where the 8-byte loads stop
+
+template<class T, std::size_t N, boost::endian::order Order, class D> void test()
+{
+    using namespace boost::endian;
+
+    std::size_t const m = 29;
+
+    unsigned char src[ m * N ];
+
+    std::uint32_t x = 12345;
+
+    for( std::size_t i = 0; i < m * N; ++i )
+    {
+        x = x * 1664525u + 1013904223u;
+        src[ i ] = static_cast<unsigned char>( x >> 24 );
+    }
+
+    for( std::size_t n = 0; n <= m; ++n )
+    {
+        D dst[ m ];
+
+        endian_convert<T, N, Order>( dst, src, n );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            BOOST_TEST_EQ( dst[ i ], static_cast<D>( endian_load<T, N, Order>( src + i * N ) ) );
+        }
+    }
+
+    // store back
+
+    {
+        D values[ m ];
+
+        endian_convert<T, N, Order>( values, src, m );
+
+        unsigned char out[ m * N ];
+
+        endian_convert_store<T, N, Order>( out, values, m );
+
+        for( std::size_t i = 0; i < m * N; ++i )
+        {
+            BOOST_TEST_EQ( out[ i ], src[ i ] );
+        }
+    }
+}
+
+// saturation: the values at and just beyond the bounds of an N-byte T;
+// below is not out of range when S is unsigned, and is then passed as lo
+
+template<class T, std::size_t N, boost::endian::order Order, class S> void test_saturate( S lo, S hi, S below, S above )
+{
+    using namespace boost::endian;
+
+    S const src[] = { lo, hi, below, above, S( 0 ), S( 1 ), below, lo };
+    std::size_t const n = sizeof( src ) / sizeof( src[ 0 ] );
+
+    bool const below_overflows = below < lo;
+
+    T const min = std::is_signed<T>::value? static_cast<T>( -( std::int64_t( 1 ) << ( 8 * N - 2 ) ) * 2 ): 0;
+    T const max = static_cast<T>( ~std::uint64_t( 0 ) >> ( 64 - 8 * N + std::is_signed<T>::value ) );
+
+    unsigned char dst[ n * N ];
+
+    BOOST_TEST_EQ( ( endian_saturate<T, N, Order>( dst, src, n ) ), below_overflows? 3u: 1u );
+
+    T const expected[] = { static_cast<T>( lo ), static_cast<T>( hi ), below_overflows? min: static_cast<T>( lo ), max, 0, 1, below_overflows? min: static_cast<T>( lo ), static_cast<T>( lo ) };
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        BOOST_TEST_EQ( ( endian_load<T, N, Order>( dst + i * N ) ), expected[ i ] );
+    }
+
+    std::uint64_t mask[ 1 ] = { ~std::uint64_t( 0 ) };
+
+    BOOST_TEST_EQ( ( endian_saturate<T, N, Order>( dst, src, n, mask ) ), below_overflows? 3u: 1u );
+    BOOST_TEST_EQ( mask[ 0 ], below_overflows? 0x4Cu: 0x08u );
+}
+
+template<class T, std::size_t N, class S> void test_saturate2( S lo, S hi, S below, S above )
+{
+    test_saturate<T, N, boost::endian::order::little>( lo, hi, below, above );
+    test_saturate<T, N, boost::endian::order::big>( lo, hi, below, above );
+}
+
+template<class T, std::size_t N, class D> void test2()
+{
+    test<T, N, boost::endian::order::little, D>();
+    test<T, N, boost::endian::order::big, D>();
+}
+
+int main()
+{
+    using namespace boost::endian;
+
+    test2<std::int16_t, 2, std::int64_t>();
+    test2<std::uint16_t, 2, std::int32_t>();
+    test2<std::uint8_t, 1, std::int32_t>();
+    test2<std::int8_t, 1, std::int16_t>();
+    test2<std::int32_t, 4, double>();
+    test2<std::int32_t, 3, std::int32_t>();
+    test2<std::uint32_t, 3, std::uint64_t>();
+    test2<std::int64_t, 5, std::int64_t>();
+    test2<std::uint64_t, 7, std::uint64_t>();
+    test2<std::int64_t, 6, double>();
+    test2<std::int16_t, 1, std::int32_t>();
+    test2<float, 4, double>();
+    test2<double, 8, double>();
+
+    // widening to float
+
+    {
+        big_int16_buf_t const src[] = { big_int16_buf_t( -32768 ), big_int16_buf_t( 1 ), big_int16_buf_t( 32767 ) };
+
+        float dst[ 3 ];
+
+        endian_convert( dst, src, 3 );
+
+        BOOST_TEST_EQ( dst[ 0 ], -32768.0f );
+        BOOST_TEST_EQ( dst[ 1 ], 1.0f );
+        BOOST_TEST_EQ( dst[ 2 ], 32767.0f );
+
+        little_int24_buf_t out[ 3 ];
+
+        endian_convert_store( out, dst, 3 );
+
+        BOOST_TEST_EQ( out[ 0 ].value(), -32768 );
+        BOOST_TEST_EQ( out[ 2 ].value(), 32767 );
+    }
+
+    // saturating stores
+
+    test_saturate2<std::int16_t, 2, std::int32_t>( -32768, 32767, -32769, 32768 );
+    test_saturate2<std::int32_t, 3, std::int32_t>( -8388608, 8388607, -8388609, 8388608 );
+    test_saturate2<std::uint32_t, 3, std::int64_t>( 0, 16777215, -1, 16777216 );
+    test_saturate2<std::int64_t, 5, std::int64_t>( -549755813888, 549755813887, -549755813889, 549755813888 );
+    test_saturate2<std::uint64_t, 6, std::uint64_t>( 0, 281474976710655u, 0, 281474976710656u );
+    test_saturate2<std::int64_t, 7, std::uint64_t>( 0, 36028797018963967u, 0, 36028797018963968u );
+    test_saturate2<std::uint8_t, 1, std::int64_t>( 0, 255, -1, 256 );
+    test_saturate2<std::int64_t, 8, std::uint64_t>( 0, 9223372036854775807u, 0, 9223372036854775808u );
+    test_saturate2<std::int16_t, 2, float>( -32768.0f, 32767.0f, -32769.0f, 32768.0f );
+    test_saturate2<std::int32_t, 3, double>( -8388608.0, 8388607.0, -1e30, 8388608.0 );
+    test_saturate2<std::uint32_t, 4, double>( 0.0, 4294967295.0, -1.0, 4294967296.0 );
+    test_saturate2<std::int64_t, 8, double>( -9223372036854775808.0, 9223372036854774784.0, -1e19, 9223372036854775808.0 );
+
+    {
+        double const src[] = { 0.0 / 0.0, 2.9, -2.9, 1e300 };
+
+        big_int24_buf_t dst[ 4 ];
+
+        BOOST_TEST_EQ( endian_saturate( dst, src, 4 ), 2u );
+
+        BOOST_TEST_EQ( dst[ 0 ].value(), 0 );
+        BOOST_TEST_EQ( dst[ 1 ].value(), 2 );
+        BOOST_TEST_EQ( dst[ 2 ].value(), -2 );
+        BOOST_TEST_EQ( dst[ 3 ].value(), 8388607 );
+    }
+
+    // fractions that truncate into range
+
+    {
+        double const src[] = { -0.5, 255.9, -0.99, -1.0, 256.0 };
+
+        std::uint64_t mask[ 1 ];
+        unsigned char dst[ 5 ];
+
+        BOOST_TEST_EQ( ( endian_saturate<std::uint8_t, 1, order::big>( dst, src, 5, mask ) ), 2u );
+        BOOST_TEST_EQ( mask[ 0 ], 0x18u );
+
+        BOOST_TEST_EQ( dst[ 0 ], 0 );
+        BOOST_TEST_EQ( dst[ 1 ], 255 );
+        BOOST_TEST_EQ( dst[ 2 ], 0 );
+        BOOST_TEST_EQ( dst[ 3 ], 0 );
+        BOOST_TEST_EQ( dst[ 4 ], 255 );
+    }
+
+    {
+        float const src[] = { -128.5f, 127.5f, -129.0f, -0.5f };
+
+        std::uint64_t mask[ 1 ];
+        unsigned char dst[ 4 ];
+
+        BOOST_TEST_EQ( ( endian_saturate<std::int8_t, 1, order::little>( dst, src, 4, mask ) ), 1u );
+        BOOST_TEST_EQ( mask[ 0 ], 0x04u );
+
+        BOOST_TEST_EQ( static_cast<std::int8_t>( dst[ 0 ] ), -128 );
+        BOOST_TEST_EQ( static_cast<std::int8_t>( dst[ 1 ] ), 127 );
+        BOOST_TEST_EQ( static_cast<std::int8_t>( dst[ 2 ] ), -128 );
+        BOOST_TEST_EQ( static_cast<std::int8_t>( dst[ 3 ] ), 0 );
+    }
+
+    {
+        // the lower bound minus 1 is not exact in float
+
+        float const src[] = { -2147483648.0f, 2147483648.0f, -2147483904.0f };
+
+        big_int32_buf_t dst[ 3 ];
+
+        BOOST_TEST_EQ( endian_saturate( dst, src, 3 ), 2u );
+
+        BOOST_TEST_EQ( dst[ 0 ].value(), -2147483647 - 1 );
+        BOOST_TEST_EQ( dst[ 1 ].value(), 2147483647 );
+        BOOST_TEST_EQ( dst[ 2 ].value(), -2147483647 - 1 );
+    }
+
+    // the mask spans several words
+
+    {
+        std::int32_t src[ 150 ];
+
+        for( std::size_t i = 0; i < 150; ++i ) src[ i ] = i % 7 == 0? 40000: static_cast<std::int32_t>( i );
+
+        little_int16_buf_t dst[ 150 ];
+        std::uint64_t mask[ 3 ];
+
+        BOOST_TEST_EQ( endian_saturate( dst, src, 150, mask ), 22u );
+
+        for( std::size_t i = 0; i < 150; ++i )
+        {
+            BOOST_TEST_EQ( ( mask[ i / 64 ] >> ( i % 64 ) ) & 1, i % 7 == 0? 1u: 0u );
+            BOOST_TEST_EQ( dst[ i ].value(), i % 7 == 0? 32767: static_cast<int>( i ) );
+        }
+    }
+
+    return boost::report_errors();
+}
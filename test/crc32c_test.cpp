@@ -0,0 +1,162 @@
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/crc32c.hpp>
+#include <boost/endian/buffers.hpp>
+#include <boost/endian/detail/endian_store.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+// bit at a time reference
+
+static std::uint32_t reference_crc32c( unsigned char const * p, std::size_t n )
+{
+    std::uint32_t c = 0xFFFFFFFFu;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        c ^= p[ i ];
+
+        for( int k = 0; k < 8; ++k )
+        {
+            c = ( c & 1 )? ( c >> 1 ) ^ 0x82F63B78u: c >> 1;
+        }
+    }
+
+    return ~c;
+}
+
+static std::vector<unsigned char> random_bytes( std::size_t n )
+{
+    std::vector<unsigned char> r( n );
+
+    std::uint32_t x = 12345;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        x = x * 1664525u + 1013904223u;
+        r[ i ] = static_cast<unsigned char>( x >> 24 );
+    }
+
+    return r;
+}
+
+template<class T, std::size_t N, boost::endian::order Order> void test_load( std::vector<unsigned char> const & v )
+{
+    using namespace boost::endian;
+
+    std::size_t const m = v.size() / N;
+
+    std::vector<T> dst( m + 1 );
+
+    for( std::size_t n = 0; n <= m; n += 1 + n / 3 )
+    {
+        BOOST_TEST_EQ( ( endian_load_crc32c<T, N, Order>( dst.data(), v.data(), n ) ), reference_crc32c( v.data(), n * N ) );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            BOOST_TEST_EQ( dst[ i ], ( endian_load<T, N, Order>( v.data() + i * N ) ) );
+        }
+    }
+}
+
+template<class T, boost::endian::order Order> void test_inplace( std::vector<unsigned char> const & v )
+{
+    using namespace boost::endian;
+
+    std::size_t const m = v.size() / sizeof( T );
+
+    for( std::size_t n = 0; n <= m; n += 1 + n / 3 )
+    {
+        std::vector<T> p( n + 1 );
+        std::memcpy( p.data(), v.data(), n * sizeof( T ) );
+
+        BOOST_TEST_EQ( ( endian_crc32c_inplace<Order>( p.data(), n ) ), reference_crc32c( v.data(), n * sizeof( T ) ) );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            BOOST_TEST_EQ( p[ i ], ( endian_load<T, sizeof( T ), Order>( v.data() + i * sizeof( T ) ) ) );
+        }
+    }
+}
+
+template<class T, std::size_t N> void test_load2( std::vector<unsigned char> const & v )
+{
+    test_load<T, N, boost::endian::order::little>( v );
+    test_load<T, N, boost::endian::order::big>( v );
+}
+
+template<class T> void test_inplace2( std::vector<unsigned char> const & v )
+{
+    test_inplace<T, boost::endian::order::little>( v );
+    test_inplace<T, boost::endian::order::big>( v );
+}
+
+int main()
+{
+    using namespace boost::endian;
+
+    {
+        char const s[] = "123456789";
+        BOOST_TEST_EQ( crc32c( reinterpret_cast<unsigned char const*>( s ), 9 ), 0xE3069283u );
+    }
+
+    {
+        unsigned char const z[ 32 ] = {};
+        BOOST_TEST_EQ( crc32c( z, 32 ), 0x8A9136AAu );
+        BOOST_TEST_EQ( crc32c( z, 0 ), 0u );
+    }
+
+    std::vector<unsigned char> const v = random_bytes( 6000 );
+
+    // every length and alignment of the tails, and continuation
+
+    for( std::size_t n = 0; n < 40; ++n )
+    {
+        for( std::size_t k = 0; k <= n; ++k )
+        {
+            std::uint32_t const c = crc32c( v.data() + 3, k );
+            BOOST_TEST_EQ( crc32c( v.data() + 3 + k, n - k, c ), reference_crc32c( v.data() + 3, n ) );
+        }
+    }
+
+    BOOST_TEST_EQ( crc32c( v.data(), v.size() ), reference_crc32c( v.data(), v.size() ) );
+
+    test_load2<std::uint16_t, 2>( v );
+    test_load2<std::int32_t, 3>( v );
+    test_load2<std::uint32_t, 4>( v );
+    test_load2<std::int64_t, 8>( v );
+    test_load2<std::uint64_t, 5>( v );
+
+    test_inplace2<std::uint16_t>( v );
+    test_inplace2<std::int32_t>( v );
+    test_inplace2<std::uint64_t>( v );
+
+    // endian_buffer arrays, and continuation across calls
+
+    {
+        big_int32_buf_t src[ 1000 ];
+
+        for( int i = 0; i < 1000; ++i ) src[ i ] = i * 7919 - 3000000;
+
+        unsigned char const * bytes = reinterpret_cast<unsigned char const*>( src );
+
+        std::int32_t dst[ 1000 ];
+
+        std::uint32_t c = endian_load_crc32c( dst, src, 600 );
+        c = endian_load_crc32c( dst + 600, src + 600, 400, c );
+
+        BOOST_TEST_EQ( c, reference_crc32c( bytes, sizeof( src ) ) );
+
+        for( int i = 0; i < 1000; ++i )
+        {
+            BOOST_TEST_EQ( dst[ i ], i * 7919 - 3000000 );
+        }
+    }
+
+    return boost::report_errors();
+}
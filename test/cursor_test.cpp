@@ -0,0 +1,202 @@
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/cursor.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+enum class kind: std::uint8_t
+{
+    request = 1, reply = 2
+};
+
+template<boost::endian::order Order> void test_round_trip()
+{
+    using namespace boost::endian;
+
+    std::uint16_t const values[] = { 1, 0x1234, 0xFFFF, 0x8000, 7 };
+
+    std::vector<unsigned char> buffer;
+
+    {
+        writer<Order> w( buffer );
+
+        BOOST_TEST( w.write( kind::reply, std::uint16_t( 0xABCD ), std::int32_t( -5 ), std::uint64_t( 0x0102030405060708 ) ) );
+        BOOST_TEST( ( w.template write<std::int32_t, 3>( -100000 ) ) );
+        BOOST_TEST( w.write( 2.5, 1.5f ) );
+        BOOST_TEST( w.write_array( values, 5 ) );
+        BOOST_TEST( w.write_bytes( "xyz", 3 ) );
+
+        // past the initial allocation of the vector
+        for( int i = 0; i < 100; ++i ) BOOST_TEST( w.write( std::uint32_t( i ) ) );
+
+        BOOST_TEST_EQ( w.tell(), 1 + 2 + 4 + 8 + 3 + 8 + 4 + 10 + 3 + 400u );
+        BOOST_TEST( w.ok() );
+    }
+
+    BOOST_TEST_EQ( buffer.size(), 1 + 2 + 4 + 8 + 3 + 8 + 4 + 10 + 3 + 400u );
+
+    BOOST_TEST_EQ( buffer[ 1 ], Order == order::big? 0xAB: 0xCD );
+    BOOST_TEST_EQ( buffer[ 7 ], Order == order::big? 0x01: 0x08 );
+
+    {
+        reader<Order> r( buffer.data(), buffer.size() );
+
+        kind k;
+        std::uint16_t a;
+        std::int32_t b;
+        std::uint64_t c;
+
+        BOOST_TEST( r.read( k, a, b, c ) );
+
+        BOOST_TEST( k == kind::reply );
+        BOOST_TEST_EQ( a, 0xABCD );
+        BOOST_TEST_EQ( b, -5 );
+        BOOST_TEST_EQ( c, 0x0102030405060708u );
+
+        BOOST_TEST_EQ( ( r.template read<std::int32_t, 3>() ), -100000 );
+        BOOST_TEST_EQ( r.template read<double>(), 2.5 );
+        BOOST_TEST_EQ( r.template read<float>(), 1.5f );
+
+        std::uint16_t v[ 5 ];
+
+        BOOST_TEST( r.read_array( v, 5 ) );
+
+        for( int i = 0; i < 5; ++i ) BOOST_TEST_EQ( v[ i ], values[ i ] );
+
+        BOOST_TEST( r.skip( 3 ) );
+
+        for( int i = 0; i < 100; ++i ) BOOST_TEST_EQ( r.template read<std::uint32_t>(), static_cast<std::uint32_t>( i ) );
+
+        BOOST_TEST_EQ( r.remaining(), 0u );
+        BOOST_TEST( r.ok() );
+
+        BOOST_TEST_EQ( r.template read<std::uint8_t>(), 0 );
+        BOOST_TEST( !r.ok() );
+    }
+
+    {
+        trusted_reader<Order> r( buffer.data(), buffer.size() );
+
+        kind k;
+        std::uint16_t a;
+
+        BOOST_TEST( r.read( k, a ) );
+        BOOST_TEST( k == kind::reply );
+        BOOST_TEST_EQ( a, 0xABCD );
+        BOOST_TEST_EQ( r.tell(), 3u );
+    }
+}
+
+template<boost::endian::order Order> void test_bounds()
+{
+    using namespace boost::endian;
+
+    unsigned char data[ 6 ] = { 1, 2, 3, 4, 5, 6 };
+
+    // a group that does not fit reads nothing
+
+    {
+        reader<Order> r( data, 6 );
+
+        std::uint32_t a = 0;
+        std::uint16_t b = 0;
+        std::uint8_t c = 0;
+
+        BOOST_TEST( !r.read( a, b, c ) );
+        BOOST_TEST( !r.ok() );
+        BOOST_TEST_EQ( a, 0u );
+        BOOST_TEST_EQ( r.remaining(), 0u );
+    }
+
+    {
+        reader<Order> r( data, 6 );
+
+        std::uint16_t v[ 4 ];
+
+        BOOST_TEST( !r.read_array( v, 4 ) );
+        BOOST_TEST( !r.ok() );
+    }
+
+    {
+        reader<Order> r( data, 6 );
+
+        std::uint32_t a;
+        std::uint16_t b;
+
+        BOOST_TEST( r.read( a, b ) );
+        BOOST_TEST_EQ( a, Order == order::big? 0x01020304u: 0x04030201u );
+        BOOST_TEST( r.ok() );
+    }
+
+    // fixed buffer
+
+    {
+        unsigned char out[ 6 ] = {};
+
+        writer<Order> w( out, 6 );
+
+        BOOST_TEST( w.write( std::uint32_t( 0x01020304 ) ) );
+        BOOST_TEST( !w.write( std::uint32_t( 5 ) ) );
+        BOOST_TEST( !w.ok() );
+        BOOST_TEST_EQ( out[ 4 ], 0 );
+    }
+
+    // an array size whose byte count wraps around
+
+    {
+        unsigned char out[ 16 ] = {};
+        std::uint64_t const v[ 2 ] = { 1, 2 };
+
+        writer<Order> w( out, 16 );
+
+        BOOST_TEST( !w.write_array( v, static_cast<std::size_t>( -1 ) / 8 + 2 ) );
+        BOOST_TEST( !w.ok() );
+        BOOST_TEST_EQ( out[ 0 ], 0 );
+    }
+
+    {
+        unsigned char out[ 6 ] = {};
+
+        trusted_writer<Order> w( out, 6 );
+
+        BOOST_TEST( w.write( std::uint32_t( 0x01020304 ), std::uint16_t( 0x0506 ) ) );
+        BOOST_TEST_EQ( out[ 0 ], Order == order::big? 1: 4 );
+        BOOST_TEST_EQ( out[ 4 ], Order == order::big? 5: 6 );
+    }
+
+    // appending to a vector with existing content
+
+    {
+        std::vector<unsigned char> v( 2, 0xEE );
+
+        {
+            trusted_writer<Order> w( v );
+
+            w.reserve( 8 );
+            w.write( std::uint64_t( 1 ) );
+
+            BOOST_TEST_EQ( w.tell(), 8u );
+        }
+
+        BOOST_TEST_EQ( v.size(), 10u );
+        BOOST_TEST_EQ( v[ 0 ], 0xEE );
+        BOOST_TEST_EQ( v[ Order == order::big? 9: 2 ], 1 );
+    }
+}
+
+int main()
+{
+    using namespace boost::endian;
+
+    test_round_trip<order::little>();
+    test_round_trip<order::big>();
+
+    test_bounds<order::little>();
+    test_bounds<order::big>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,186 @@
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/format_reader.hpp>
+#include <boost/endian/conversion.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::endian;
+
+// a minimal TIFF: header, one IFD with a single StripOffsets entry and the
+// strip, four 16-bit samples
+
+template<order Order> void make_tiff( unsigned char * p )
+{
+    p[ 0 ] = p[ 1 ] = Order == order::little? 'I': 'M';
+
+    endian_store<std::uint16_t, 2, Order>( p + 2, 42 );
+    endian_store<std::uint32_t, 4, Order>( p + 4, 8 );
+
+    endian_store<std::uint16_t, 2, Order>( p + 8, 1 );
+
+    endian_store<std::uint16_t, 2, Order>( p + 10, 273 ); // StripOffsets
+    endian_store<std::uint16_t, 2, Order>( p + 12, 4 );   // LONG
+    endian_store<std::uint32_t, 4, Order>( p + 14, 1 );
+    endian_store<std::uint32_t, 4, Order>( p + 18, 26 );
+
+    endian_store<std::uint32_t, 4, Order>( p + 22, 0 );
+
+    for( int i = 0; i < 4; ++i )
+    {
+        endian_store<std::uint16_t, 2, Order>( p + 26 + 2 * i, static_cast<std::uint16_t>( 0x1234 * ( i + 1 ) ) );
+    }
+}
+
+struct tiff_reader
+{
+    std::uint16_t * samples;
+
+    template<order Order> std::size_t operator()( endian_cursor<Order> c ) const
+    {
+        c.skip( 4 );
+
+        endian_cursor<Order> ifd = c.at( c.template read<std::uint32_t>() );
+
+        std::uint16_t const entries = ifd.template read<std::uint16_t>();
+
+        std::uint32_t strip = 0;
+
+        for( std::uint16_t i = 0; i < entries; ++i )
+        {
+            std::uint16_t const tag = ifd.template read<std::uint16_t>();
+
+            ifd.skip( 6 );
+
+            std::uint32_t const value = ifd.template read<std::uint32_t>();
+
+            if( tag == 273 ) strip = value;
+        }
+
+        if( !ifd.ok() || !c.seek( strip ) ) return 0;
+
+        if( !c.read_array( samples, 4 ) ) return 0;
+
+        return c.tell();
+    }
+};
+
+template<order Order> void test_tiff()
+{
+    unsigned char file[ 34 ];
+
+    make_tiff<Order>( file );
+
+    order o = order::native;
+
+    BOOST_TEST( tiff_order( file, sizeof( file ), o ) );
+    BOOST_TEST( o == Order );
+
+    std::uint16_t samples[ 4 ] = {};
+
+    tiff_reader r = { samples };
+
+    BOOST_TEST_EQ( read_with_order( o, file, sizeof( file ), r ), 34u );
+
+    for( int i = 0; i < 4; ++i )
+    {
+        BOOST_TEST_EQ( samples[ i ], 0x1234 * ( i + 1 ) );
+    }
+
+    // truncated strip
+
+    BOOST_TEST_EQ( read_with_order( o, file, sizeof( file ) - 1, r ), 0u );
+}
+
+int main()
+{
+    test_tiff<order::little>();
+    test_tiff<order::big>();
+
+    // cursor
+
+    {
+        unsigned char const data[] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07 };
+
+        endian_cursor<order::big> c( data, sizeof( data ) );
+
+        BOOST_TEST_EQ( c.read<std::uint16_t>(), 0x0102 );
+        BOOST_TEST_EQ( ( c.read<std::uint32_t, 3>() ), 0x030405u );
+        BOOST_TEST( c.ok() );
+        BOOST_TEST_EQ( c.remaining(), 2u );
+
+        BOOST_TEST_EQ( c.read<std::uint32_t>(), 0u );
+        BOOST_TEST( !c.ok() );
+        BOOST_TEST_EQ( c.remaining(), 0u );
+
+        endian_cursor<order::little> d( data, sizeof( data ) );
+
+        BOOST_TEST_EQ( d.read<std::int16_t>(), 0x0201 );
+
+        std::uint16_t a[ 3 ];
+
+        BOOST_TEST( d.read_array( a, 2 ) );
+        BOOST_TEST_EQ( a[ 0 ], 0x0403 );
+        BOOST_TEST_EQ( a[ 1 ], 0x0605 );
+
+        BOOST_TEST( !d.read_array( a, 1 ) );
+        BOOST_TEST( !d.ok() );
+
+        BOOST_TEST( !c.at( 8 ).ok() );
+        BOOST_TEST( c.at( 7 ).ok() );
+    }
+
+    {
+        unsigned char data[ 40 ];
+
+        float const f[ 5 ] = { 1.0f, -2.5f, 3.25f, 0.0f, 1e10f };
+
+        for( int i = 0; i < 5; ++i )
+        {
+            endian_store<float, 4, order::big>( data + 4 * i, f[ i ] );
+        }
+
+        float g[ 5 ];
+
+        endian_cursor<order::big> c( data, sizeof( data ) );
+
+        BOOST_TEST( c.read_array( g, 5 ) );
+
+        for( int i = 0; i < 5; ++i )
+        {
+            BOOST_TEST_EQ( g[ i ], f[ i ] );
+        }
+    }
+
+    // order detection
+
+    {
+        unsigned char const elf[] = { 0x7F, 'E', 'L', 'F', 2, 2 };
+
+        order o = order::little;
+
+        BOOST_TEST( elf_order( elf, sizeof( elf ), o ) );
+        BOOST_TEST( o == order::big );
+
+        BOOST_TEST( !elf_order( elf, 5, o ) );
+
+        unsigned char const magic[] = { 0x4D, 0x3C, 0x2B, 0x1A };
+
+        BOOST_TEST( detect_order( magic, std::uint32_t( 0x1A2B3C4D ), o ) );
+        BOOST_TEST( o == order::little );
+
+        BOOST_TEST( ( detect_order<std::uint32_t, 3>( magic, 0x4D3C2B, o ) ) );
+        BOOST_TEST( o == order::big );
+
+        BOOST_TEST( !detect_order( magic, std::uint32_t( 0x1A2B3C4E ), o ) );
+
+        unsigned char const not_tiff[] = { 'I', 'M', 42, 0 };
+
+        BOOST_TEST( !tiff_order( not_tiff, 4, o ) );
+    }
+
+    return boost::report_errors();
+}
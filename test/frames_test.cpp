@@ -0,0 +1,159 @@
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/frames.hpp>
+#include <boost/endian/detail/endian_store.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+typedef std::vector<unsigned char> bytes;
+
+struct collector
+{
+    std::vector<bytes> * frames;
+
+    // the chunk being fed, to tell the frames passed in place
+    unsigned char const * first;
+    unsigned char const * last;
+
+    std::size_t * in_place;
+
+    void operator()( unsigned char const * p, std::size_t n ) const
+    {
+        frames->push_back( bytes( p, p + n ) );
+        if( p >= first && p + n <= last ) ++*in_place;
+    }
+};
+
+template<std::size_t N, boost::endian::order Order> void test()
+{
+    using namespace boost::endian;
+
+    std::vector<bytes> expected;
+    bytes stream;
+
+    std::uint32_t x = 12345;
+
+    for( int i = 0; i < 200; ++i )
+    {
+        x = x * 1664525u + 1013904223u;
+
+        // mostly small frames, some empty, some as long as N bytes allow
+        std::size_t const n = i % 17 == 0? 0: i % 23 == 0? ( N == 1? 200 + x % 56: 1000 + x % 3000 ): x % 40;
+
+        bytes f( n );
+        for( std::size_t j = 0; j < n; ++j ) f[ j ] = static_cast<unsigned char>( x >> ( j % 24 ) );
+
+        expected.push_back( f );
+
+        unsigned char h[ N ];
+        endian_store<std::uint64_t, N, Order>( h, n );
+
+        stream.insert( stream.end(), h, h + N );
+        stream.insert( stream.end(), f.begin(), f.end() );
+    }
+
+    std::size_t const chunks[] = { 1, 2, 7, 64, 1000, stream.size() };
+
+    for( std::size_t c = 0; c < sizeof( chunks ) / sizeof( chunks[ 0 ] ); ++c )
+    {
+        frame_splitter<N, Order> s;
+
+        std::vector<bytes> frames;
+        std::size_t in_place = 0;
+        std::size_t count = 0;
+
+        for( std::size_t i = 0; i < stream.size(); i += chunks[ c ] )
+        {
+            std::size_t const m = stream.size() - i < chunks[ c ]? stream.size() - i: chunks[ c ];
+
+            collector f = { &frames, &stream[ i ], &stream[ i ] + m, &in_place };
+            count += s.feed( &stream[ i ], m, f );
+        }
+
+        BOOST_TEST( s.ok() );
+        BOOST_TEST_EQ( s.buffered(), 0u );
+        BOOST_TEST_EQ( count, expected.size() );
+        BOOST_TEST( frames == expected );
+
+        if( chunks[ c ] == stream.size() )
+        {
+            BOOST_TEST_EQ( in_place, expected.size() );
+        }
+    }
+
+    // split_frames stops at the incomplete frame
+
+    {
+        std::vector<bytes> frames;
+        std::size_t in_place = 0;
+
+        collector f = { &frames, 0, 0, &in_place };
+
+        std::size_t const k = split_frames<N, Order>( stream.data(), stream.size() - 1, f );
+
+        BOOST_TEST_EQ( frames.size(), expected.size() - 1 );
+        BOOST_TEST_EQ( k, stream.size() - N - expected.back().size() );
+    }
+}
+
+template<std::size_t N> void test2()
+{
+    test<N, boost::endian::order::big>();
+    test<N, boost::endian::order::little>();
+}
+
+void test_max_size()
+{
+    using namespace boost::endian;
+
+    unsigned char const stream[] = { 0, 2, 'a', 'b', 0, 9, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 1, 'c' };
+
+    std::vector<bytes> frames;
+    std::size_t in_place = 0;
+
+    collector f = { &frames, 0, 0, &in_place };
+
+    {
+        frame_splitter<2> s( 8 );
+
+        BOOST_TEST_EQ( s.feed( stream, sizeof( stream ), f ), 1u );
+        BOOST_TEST( !s.ok() );
+        BOOST_TEST_EQ( s.feed( stream, sizeof( stream ), f ), 0u );
+
+        s.reset();
+
+        BOOST_TEST( s.ok() );
+        BOOST_TEST_EQ( s.feed( stream, 4, f ), 1u );
+    }
+
+    // the long length arrives in pieces
+
+    {
+        frame_splitter<2> s( 8 );
+
+        BOOST_TEST_EQ( s.feed( stream, 5, f ), 1u );
+        BOOST_TEST( s.ok() );
+        BOOST_TEST_EQ( s.buffered(), 1u );
+        BOOST_TEST_EQ( s.feed( stream + 5, 1, f ), 0u );
+        BOOST_TEST( !s.ok() );
+    }
+
+    BOOST_TEST_EQ( frames.size(), 3u );
+}
+
+int main()
+{
+    test2<1>();
+    test2<2>();
+    test2<3>();
+    test2<4>();
+    test2<8>();
+
+    test_max_size();
+
+    return boost::report_errors();
+}
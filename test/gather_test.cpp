@@ -0,0 +1,131 @@
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/gather.hpp>
+#include <boost/endian/cursor.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// the members of struct iovec, without depending on <sys/uio.h>
+
+struct test_iovec
+{
+    void * iov_base;
+    std::size_t iov_len;
+};
+
+// builds the same message with a gather_writer and with a writer, and
+// compares the bytes
+
+template<boost::endian::order Order> void test()
+{
+    using namespace boost::endian;
+
+    std::vector<unsigned char> payload( 100000 );
+
+    for( std::size_t i = 0; i < payload.size(); ++i ) payload[ i ] = static_cast<unsigned char>( i * 7 );
+
+    gather_writer<Order> g;
+
+    std::size_t const length = g.template placeholder<std::uint32_t>();
+
+    BOOST_TEST( g.write( std::uint16_t( 0x1234 ), std::uint8_t( 9 ), std::int64_t( -2 ) ) );
+    BOOST_TEST( ( g.template write<std::uint32_t, 3>( 0xABCDEF ) ) );
+    BOOST_TEST( g.reference( payload.data(), payload.size() ) );
+    BOOST_TEST( g.write( 0.25 ) );
+    BOOST_TEST( g.write_bytes( "end", 3 ) );
+    BOOST_TEST( g.reference( payload.data(), 0 ) );
+
+    std::size_t const expected_size = 4 + gather_size( std::uint16_t(), std::uint8_t(), std::int64_t() ) + 3 + payload.size() + 8 + 3;
+
+    BOOST_TEST_EQ( g.size(), expected_size );
+
+    g.template patch<std::uint32_t>( length, static_cast<std::uint32_t>( g.size() ) );
+
+    // header values share a segment; the payload is referenced in place
+
+    BOOST_TEST_EQ( g.segment_count(), 3u );
+    BOOST_TEST( g.segments()[ 1 ].data == payload.data() );
+    BOOST_TEST( g.ok() );
+
+    std::vector<unsigned char> expected;
+
+    {
+        writer<Order> w( expected );
+
+        w.write( static_cast<std::uint32_t>( expected_size ) );
+        w.write( std::uint16_t( 0x1234 ), std::uint8_t( 9 ), std::int64_t( -2 ) );
+        w.template write<std::uint32_t, 3>( 0xABCDEF );
+        w.write_bytes( payload.data(), payload.size() );
+        w.write( 0.25 );
+        w.write_bytes( "end", 3 );
+    }
+
+    BOOST_TEST_EQ( expected.size(), expected_size );
+
+    std::vector<unsigned char> out( g.size() );
+    g.copy_to( out.data() );
+
+    BOOST_TEST( out == expected );
+
+    test_iovec iov[ 8 ];
+
+    BOOST_TEST_EQ( g.to_iovec( iov, 8 ), 3u );
+    BOOST_TEST_EQ( iov[ 0 ].iov_len, 4 + 11 + 3u );
+    BOOST_TEST_EQ( iov[ 1 ].iov_len, payload.size() );
+
+    // too small for all the segments
+
+    iov[ 0 ].iov_len = 0;
+
+    BOOST_TEST_EQ( g.to_iovec( iov, 2 ), 0u );
+    BOOST_TEST_EQ( iov[ 0 ].iov_len, 0u );
+
+    g.clear();
+
+    BOOST_TEST_EQ( g.size(), 0u );
+    BOOST_TEST_EQ( g.segment_count(), 0u );
+}
+
+void test_limits()
+{
+    using namespace boost::endian;
+
+    unsigned char const data[ 4 ] = {};
+
+    {
+        gather_writer<order::big, 8, 4> g;
+
+        BOOST_TEST( g.write( std::uint32_t( 1 ) ) );
+        BOOST_TEST( !g.write( std::uint64_t( 2 ) ) );
+        BOOST_TEST( !g.ok() );
+        BOOST_TEST_EQ( g.size(), 4u );
+        BOOST_TEST_EQ( ( g.placeholder<std::uint64_t>() ), 8u );
+        BOOST_TEST( g.write( std::uint32_t( 3 ) ) );
+        BOOST_TEST_EQ( g.size(), 8u );
+    }
+
+    {
+        gather_writer<order::little, 64, 2> g;
+
+        BOOST_TEST( g.write( std::uint8_t( 1 ) ) );
+        BOOST_TEST( g.reference( data, 4 ) );
+        BOOST_TEST( !g.write( std::uint8_t( 2 ) ) );
+        BOOST_TEST( !g.reference( data, 4 ) );
+        BOOST_TEST_EQ( g.size(), 5u );
+        BOOST_TEST_EQ( g.segment_count(), 2u );
+    }
+}
+
+int main()
+{
+    test<boost::endian::order::little>();
+    test<boost::endian::order::big>();
+
+    test_limits();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,117 @@
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/histogram.hpp>
+#include <boost/endian/arithmetic.hpp>
+#include <boost/endian/buffers.hpp>
+#include <boost/endian/conversion.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+
+int main()
+{
+    using namespace boost::endian;
+
+    // histogram over raw bytes
+
+    {
+        unsigned char const v[] = { 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x01, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x07 };
+
+        std::uint32_t bins[ 8 ] = { 0 };
+
+        std::size_t r = endian_histogram<std::uint16_t, 2, order::big>( bins, 8, v, 7 );
+
+        BOOST_TEST_EQ( r, 1u );
+
+        BOOST_TEST_EQ( bins[ 0 ], 0u );
+        BOOST_TEST_EQ( bins[ 1 ], 3u );
+        BOOST_TEST_EQ( bins[ 2 ], 1u );
+        BOOST_TEST_EQ( bins[ 3 ], 1u );
+        BOOST_TEST_EQ( bins[ 7 ], 1u );
+    }
+
+    {
+        unsigned char const v[] = { 0x01, 0x00, 0x00, 0x00, 0x01 };
+
+        std::uint32_t bins[ 2 ] = { 0 };
+
+        BOOST_TEST_EQ( (endian_histogram<std::uint32_t, 3, order::little>( bins, 2, v, 1 )), 0u );
+        BOOST_TEST_EQ( bins[ 1 ], 1u );
+
+        BOOST_TEST_EQ( (endian_histogram<std::uint32_t, 3, order::little>( bins, 2, v + 2, 1 )), 1u );
+    }
+
+    // histogram over buffers; negative keys are out of range
+
+    {
+        big_int32_buf_t v[ 10 ];
+
+        for( int i = 0; i < 10; ++i ) v[ i ] = i % 4;
+        v[ 9 ] = -1;
+
+        std::size_t bins[ 4 ] = { 0 };
+
+        BOOST_TEST_EQ( endian_histogram( bins, 4, v, 10 ), 1u );
+
+        BOOST_TEST_EQ( bins[ 0 ], 3u );
+        BOOST_TEST_EQ( bins[ 1 ], 2u );
+        BOOST_TEST_EQ( bins[ 2 ], 2u );
+        BOOST_TEST_EQ( bins[ 3 ], 2u );
+    }
+
+    // counter updates
+
+    {
+        big_uint64_t c[ 4 ];
+
+        for( int i = 0; i < 4; ++i ) c[ i ] = 100;
+
+        std::uint32_t const index[] = { 0, 2, 2, 2, 1, 2, 7, 7, 3 };
+        std::uint64_t const delta[] = { 1, 2, 3, 4, 5, 6, 7, 8, 0xFFFFFFFFFFFFFFFFull };
+
+        BOOST_TEST_EQ( endian_counter_update( c, 4, index, delta, 9 ), 2u );
+
+        BOOST_TEST_EQ( c[ 0 ], 101u );
+        BOOST_TEST_EQ( c[ 1 ], 105u );
+        BOOST_TEST_EQ( c[ 2 ], 115u );
+        BOOST_TEST_EQ( c[ 3 ], 99u );
+
+        BOOST_TEST_EQ( endian_counter_update( c, 4, index, 6 ), 0u );
+
+        BOOST_TEST_EQ( c[ 0 ], 102u );
+        BOOST_TEST_EQ( c[ 1 ], 106u );
+        BOOST_TEST_EQ( c[ 2 ], 119u );
+        BOOST_TEST_EQ( c[ 3 ], 99u );
+    }
+
+    {
+        little_int16_buf_t c[ 3 ];
+
+        c[ 0 ] = 0;
+        c[ 1 ] = 10;
+        c[ 2 ] = -10;
+
+        unsigned char const index[] = { 1, 1, 0, 2 };
+        std::int16_t const delta[] = { -5, -10, 7, 3 };
+
+        BOOST_TEST_EQ( endian_counter_update( c, 3, index, delta, 4 ), 0u );
+
+        BOOST_TEST_EQ( c[ 0 ].value(), 7 );
+        BOOST_TEST_EQ( c[ 1 ].value(), -5 );
+        BOOST_TEST_EQ( c[ 2 ].value(), -7 );
+    }
+
+    {
+        unsigned char c[ 6 ] = { 0 };
+        int const index[] = { 1, 0, 1 };
+
+        BOOST_TEST_EQ( (endian_counter_update<std::uint32_t, 3, order::big>( c, 2, index, 0, 3 )), 0u );
+
+        BOOST_TEST_EQ( load_big_u24( c ), 1u );
+        BOOST_TEST_EQ( load_big_u24( c + 3 ), 2u );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,140 @@
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/inet_checksum.hpp>
+#include <boost/endian/net_headers.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+
+// the RFC 1071 reference algorithm
+
+static std::uint16_t reference_checksum( unsigned char const * p, std::size_t n )
+{
+    std::uint32_t s = 0;
+
+    for( std::size_t i = 0; i < n; i += 2 )
+    {
+        s += static_cast<std::uint32_t>( p[ i ] << 8 ) + ( i + 1 < n? p[ i + 1 ]: 0 );
+    }
+
+    while( s >> 16 ) s = ( s & 0xFFFF ) + ( s >> 16 );
+
+    return static_cast<std::uint16_t>( ~s );
+}
+
+int main()
+{
+    using namespace boost::endian;
+
+    // IPv4 header, checksum 0xB861
+
+    unsigned char header[] =
+    {
+        0x45, 0x00, 0x00, 0x73, 0x00, 0x00, 0x40, 0x00, 0x40, 0x11,
+        0x00, 0x00, 0xC0, 0xA8, 0x00, 0x01, 0xC0, 0xA8, 0x00, 0xC7
+    };
+
+    BOOST_TEST_EQ( inet_checksum( header, sizeof( header ) ), 0xB861 );
+
+    header[ 10 ] = 0xB8;
+    header[ 11 ] = 0x61;
+
+    BOOST_TEST_EQ( inet_checksum( header, sizeof( header ) ), 0 );
+
+    // all lengths and alignments against the reference
+
+    {
+        unsigned char data[ 300 ];
+
+        std::uint32_t x = 1;
+
+        for( std::size_t i = 0; i < sizeof( data ); ++i )
+        {
+            x = x * 1664525u + 1013904223u;
+            data[ i ] = static_cast<unsigned char>( x >> 24 );
+        }
+
+        for( std::size_t offset = 0; offset < 4; ++offset )
+        {
+            for( std::size_t n = 0; n <= 100; ++n )
+            {
+                BOOST_TEST_EQ( inet_checksum( data + offset, n ), reference_checksum( data + offset, n ) );
+            }
+        }
+
+        BOOST_TEST_EQ( inet_checksum( data, 300 ), reference_checksum( data, 300 ) );
+
+        // in pieces
+
+        std::uint16_t s = inet_sum( data, 64 );
+        s = inet_sum( data + 64, 38, s );
+
+        BOOST_TEST_EQ( inet_checksum( data + 102, 99, s ), reference_checksum( data, 201 ) );
+    }
+
+    {
+        // carries across the whole width
+
+        unsigned char data[ 64 ];
+
+        for( int i = 0; i < 64; ++i ) data[ i ] = 0xFF;
+
+        BOOST_TEST_EQ( inet_checksum( data, 64 ), 0 );
+        BOOST_TEST_EQ( inet_checksum( data, 63 ), reference_checksum( data, 63 ) );
+    }
+
+    // incremental update
+
+    {
+        std::uint16_t c = 0xB861;
+
+        std::uint16_t c2 = inet_checksum_update16( c, 0x4011, 0x3F11 );
+
+        header[ 8 ] = 0x3F;
+        header[ 10 ] = 0;
+        header[ 11 ] = 0;
+
+        BOOST_TEST_EQ( c2, inet_checksum( header, sizeof( header ) ) );
+
+        std::uint16_t c3 = inet_checksum_update32( c2, 0xC0A800C7, 0x0A000001 );
+
+        header[ 16 ] = 0x0A;
+        header[ 17 ] = 0x00;
+        header[ 18 ] = 0x00;
+        header[ 19 ] = 0x01;
+
+        BOOST_TEST_EQ( c3, inet_checksum( header, sizeof( header ) ) );
+    }
+
+    // assignment proxy
+
+    {
+        unsigned char h[] =
+        {
+            0x45, 0x00, 0x00, 0x73, 0x00, 0x00, 0x40, 0x00, 0x40, 0x11,
+            0xB8, 0x61, 0xC0, 0xA8, 0x00, 0x01, 0xC0, 0xA8, 0x00, 0xC7
+        };
+
+        ipv4_header * ip = reinterpret_cast<ipv4_header *>( h );
+
+        with_checksum( ip->destination, ip->checksum ) = 0x08080808;
+        with_checksum( ip->total_length, ip->checksum ) = 0xFFFF;
+        with_checksum( ip->identification, ip->checksum ) = 0x1234;
+
+        BOOST_TEST_EQ( ip->destination.value(), 0x08080808u );
+        BOOST_TEST_EQ( ip->total_length.value(), 0xFFFF );
+        BOOST_TEST_EQ( inet_checksum( h, sizeof( h ) ), 0 );
+
+        big_uint16_t port( 80 );
+        big_uint16_t checksum( 0 );
+
+        with_checksum( port, checksum ) = 8080;
+
+        BOOST_TEST_EQ( port, 8080 );
+        BOOST_TEST_EQ( ( std::uint16_t )( with_checksum( port, checksum ) ), 8080 );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,298 @@
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/msgpack.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <initializer_list>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::endian;
+
+typedef std::vector<unsigned char> bytes;
+
+static bytes encode_uint( std::uint64_t v )
+{
+    unsigned char buffer[ 16 ];
+    msgpack_writer w( buffer, sizeof( buffer ) );
+
+    w.write_uint( v );
+    return bytes( buffer, buffer + w.size() );
+}
+
+static bytes encode_int( std::int64_t v )
+{
+    unsigned char buffer[ 16 ];
+    msgpack_writer w( buffer, sizeof( buffer ) );
+
+    w.write_int( v );
+    return bytes( buffer, buffer + w.size() );
+}
+
+static bytes make( std::initializer_list<unsigned> v )
+{
+    bytes r;
+    for( unsigned x: v ) r.push_back( static_cast<unsigned char>( x ) );
+    return r;
+}
+
+// the encodings of the MessagePack specification
+
+static void test_encodings()
+{
+    BOOST_TEST( encode_uint( 0 ) == make( { 0x00 } ) );
+    BOOST_TEST( encode_uint( 127 ) == make( { 0x7F } ) );
+    BOOST_TEST( encode_uint( 128 ) == make( { 0xCC, 0x80 } ) );
+    BOOST_TEST( encode_uint( 256 ) == make( { 0xCD, 0x01, 0x00 } ) );
+    BOOST_TEST( encode_uint( 65536 ) == make( { 0xCE, 0x00, 0x01, 0x00, 0x00 } ) );
+    BOOST_TEST( encode_uint( 0x100000000 ) == make( { 0xCF, 0, 0, 0, 1, 0, 0, 0, 0 } ) );
+
+    BOOST_TEST( encode_int( 5 ) == make( { 0x05 } ) );
+    BOOST_TEST( encode_int( -1 ) == make( { 0xFF } ) );
+    BOOST_TEST( encode_int( -32 ) == make( { 0xE0 } ) );
+    BOOST_TEST( encode_int( -33 ) == make( { 0xD0, 0xDF } ) );
+    BOOST_TEST( encode_int( -129 ) == make( { 0xD1, 0xFF, 0x7F } ) );
+    BOOST_TEST( encode_int( -32769 ) == make( { 0xD2, 0xFF, 0xFF, 0x7F, 0xFF } ) );
+    BOOST_TEST( encode_int( -2147483649LL ) == make( { 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF } ) );
+
+    unsigned char buffer[ 64 ];
+
+    {
+        msgpack_writer w( buffer, sizeof( buffer ) );
+
+        w.write_float( 1.5 );
+        w.write_float( 1.5f );
+        w.write_nil();
+        w.write_bool( true );
+        w.write_str( "abc", 3 );
+        w.write_array_header( 2 );
+        w.write_map_header( 16 );
+
+        BOOST_TEST( w.ok() );
+        BOOST_TEST( bytes( buffer, buffer + w.size() ) == make( { 0xCB, 0x3F, 0xF8, 0, 0, 0, 0, 0, 0, 0xCA, 0x3F, 0xC0, 0, 0, 0xC0, 0xC3, 0xA3, 'a', 'b', 'c', 0x92, 0xDE, 0x00, 0x10 } ) );
+    }
+
+    {
+        char s[ 40 ];
+        std::memset( s, 'x', sizeof( s ) );
+
+        msgpack_writer w( buffer, sizeof( buffer ) );
+
+        w.write_str( s, 32 );
+        BOOST_TEST_EQ( buffer[ 0 ], 0xD9 );
+        BOOST_TEST_EQ( buffer[ 1 ], 32 );
+
+        w.write_bin( s, 3 );
+        BOOST_TEST_EQ( buffer[ 34 ], 0xC4 );
+        BOOST_TEST_EQ( buffer[ 35 ], 3 );
+
+        BOOST_TEST( !w.write_str( s, 40 ) );
+        BOOST_TEST( !w.ok() );
+        BOOST_TEST_EQ( w.size(), 39u );
+    }
+}
+
+static void test_round_trip()
+{
+    std::vector<double> xs( 1000 );
+    for( std::size_t i = 0; i < xs.size(); ++i ) xs[ i ] = i * 0.25 - 100;
+
+    std::int32_t const ys[] = { 0, -1, 127, 128, -32, -33, 65535, -2147483647 - 1, 2147483647 };
+    std::size_t const ny = sizeof( ys ) / sizeof( ys[ 0 ] );
+
+    std::vector<unsigned char> buffer( 20000 );
+
+    msgpack_writer w( buffer.data(), buffer.size() );
+
+    w.write_map_header( 4 );
+
+    w.write_str( "id", 2 );
+    w.write_uint( 0xFFFFFFFFFFFFFFFFu );
+
+    w.write_str( "xs", 2 );
+    w.write_array( xs.data(), xs.size() );
+
+    w.write_str( "ys", 2 );
+    w.write_array( ys, ny );
+
+    w.write_str( "ext", 3 );
+    {
+        // fixext 4 of type 7, written by hand
+        unsigned char const e[] = { 0xD6, 7, 1, 2, 3, 4 };
+        std::memcpy( buffer.data() + w.size(), e, 6 );
+    }
+
+    std::size_t const size = w.size() + 6;
+
+    BOOST_TEST( w.ok() );
+
+    msgpack_reader r( buffer.data(), size );
+
+    std::size_t n;
+
+    BOOST_TEST( r.next_type() == msgpack_type::map );
+    BOOST_TEST( r.read_map_header( n ) );
+    BOOST_TEST_EQ( n, 4u );
+
+    char const * s;
+
+    BOOST_TEST( r.read_str( s, n ) );
+    BOOST_TEST_EQ( std::string( s, n ), "id" );
+
+    {
+        std::int64_t v;
+        BOOST_TEST( !r.read_int( v ) );
+
+        std::uint64_t u;
+        BOOST_TEST( r.read_int( u ) );
+        BOOST_TEST_EQ( u, 0xFFFFFFFFFFFFFFFFu );
+    }
+
+    BOOST_TEST( r.read_str( s, n ) );
+
+    {
+        std::vector<double> v( 1000 );
+
+        // too small, then of the wrong type
+        BOOST_TEST( !r.read_array( v.data(), 999, n ) );
+
+        std::vector<std::int32_t> w( 1000 );
+        BOOST_TEST( !r.read_array( w.data(), 1000, n ) );
+
+        BOOST_TEST( r.read_array( v.data(), 1000, n ) );
+        BOOST_TEST_EQ( n, 1000u );
+        BOOST_TEST( v == xs );
+    }
+
+    BOOST_TEST( r.read_str( s, n ) );
+
+    {
+        std::int16_t v16[ 16 ];
+
+        // 65535 and the 32-bit extremes do not fit
+        BOOST_TEST( !r.read_array( v16, 16, n ) );
+
+        std::int64_t v[ 16 ];
+
+        BOOST_TEST( r.read_array( v, 16, n ) );
+        BOOST_TEST_EQ( n, ny );
+
+        for( std::size_t i = 0; i < ny; ++i ) BOOST_TEST_EQ( v[ i ], ys[ i ] );
+    }
+
+    BOOST_TEST( r.read_str( s, n ) );
+
+    {
+        msgpack_item const it = r.peek();
+
+        BOOST_TEST( it.type == msgpack_type::ext );
+        BOOST_TEST_EQ( it.ext_type, 7 );
+        BOOST_TEST_EQ( it.value, 4u );
+        BOOST_TEST( r.skip() );
+    }
+
+    BOOST_TEST( r.empty() );
+    BOOST_TEST( r.ok() );
+
+    // the whole map as one item
+
+    msgpack_reader r2( buffer.data(), size );
+
+    BOOST_TEST( r2.skip() );
+    BOOST_TEST_EQ( r2.tell(), size );
+
+    // truncated
+
+    for( std::size_t k = 0; k < size; k += 7 )
+    {
+        msgpack_reader r3( buffer.data(), k );
+
+        BOOST_TEST( !r3.skip() );
+        BOOST_TEST( !r3.ok() );
+    }
+}
+
+static void test_mixed_floats()
+{
+    unsigned char buffer[ 64 ];
+
+    msgpack_writer w( buffer, sizeof( buffer ) );
+
+    w.write_array_header( 4 );
+    w.write_float( 1.0 );
+    w.write_float( 2.0f );
+    w.write_float( 3.0 );
+    w.write_float( 4.0f );
+
+    {
+        msgpack_reader r( buffer, w.size() );
+
+        float v[ 4 ];
+        std::size_t n;
+
+        BOOST_TEST( r.read_array( v, 4, n ) );
+        BOOST_TEST_EQ( v[ 0 ], 1.0f );
+        BOOST_TEST_EQ( v[ 3 ], 4.0f );
+        BOOST_TEST( r.empty() );
+    }
+
+    {
+        float const f[] = { 1.5f, -2.5f };
+
+        msgpack_writer w2( buffer, sizeof( buffer ) );
+        w2.write_array( f, 2 );
+
+        msgpack_reader r( buffer, w2.size() );
+
+        double v[ 2 ];
+        std::size_t n;
+
+        BOOST_TEST( r.read_array( v, 2, n ) );
+        BOOST_TEST_EQ( v[ 1 ], -2.5 );
+    }
+}
+
+static void test_invalid()
+{
+    unsigned char const c1[] = { 0xC1 };
+
+    msgpack_reader r( c1, 1 );
+
+    BOOST_TEST( r.next_type() == msgpack_type::invalid );
+    BOOST_TEST( !r.skip() );
+
+    // an array claiming more elements than there are bytes
+
+    unsigned char const a[] = { 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0x01 };
+
+    msgpack_reader r2( a, sizeof( a ) );
+
+    BOOST_TEST( !r2.skip() );
+    BOOST_TEST( !r2.ok() );
+
+    // a string longer than the input
+
+    unsigned char const s[] = { 0xA5, 'a', 'b' };
+
+    msgpack_reader r3( s, sizeof( s ) );
+
+    char const * p;
+    std::size_t n;
+
+    BOOST_TEST( !r3.read_str( p, n ) );
+    BOOST_TEST( !r3.ok() );
+}
+
+int main()
+{
+    test_encodings();
+    test_round_trip();
+    test_mixed_floats();
+    test_invalid();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,207 @@
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/net_headers.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::endian;
+
+// Ethernet + IPv4 + TCP, 4 payload bytes and 2 bytes of Ethernet padding
+
+static unsigned char const ipv4_tcp[] =
+{
+    0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0x08, 0x00,
+
+    0x45, 0x00, 0x00, 0x2C, 0x12, 0x34, 0x40, 0x00, 0x40, 0x06, 0xAB, 0xCD,
+    0xC0, 0xA8, 0x00, 0x01, 0xC0, 0xA8, 0x00, 0x02,
+
+    0x30, 0x39, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0x18, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+
+    'a', 'b', 'c', 'd',
+
+    0, 0
+};
+
+// Ethernet + 802.1Q + IPv6 + UDP, 3 payload bytes
+
+static unsigned char const vlan_ipv6_udp[] =
+{
+    0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0x81, 0x00,
+
+    0xA0, 0x64, 0x86, 0xDD,
+
+    0x60, 0x12, 0x34, 0x56, 0x00, 0x0B, 0x11, 0x40,
+    0x20, 0x01, 0x0D, 0xB8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0x20, 0x01, 0x0D, 0xB8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+
+    0x04, 0xD2, 0x00, 0x35, 0x00, 0x0B, 0x00, 0x00,
+
+    'x', 'y', 'z'
+};
+
+int main()
+{
+    // constant offsets
+
+    BOOST_ENDIAN_STATIC_ASSERT( offsetof( ipv4_header, protocol ) == 9 );
+    BOOST_ENDIAN_STATIC_ASSERT( offsetof( ipv4_header, source ) == 12 );
+    BOOST_ENDIAN_STATIC_ASSERT( offsetof( tcp_header, window ) == 14 );
+    BOOST_ENDIAN_STATIC_ASSERT( offsetof( udp_header, length ) == 4 );
+
+    // header_view
+
+    {
+        header_view<ipv4_header> v( ipv4_tcp + 14, sizeof( ipv4_tcp ) - 14 );
+
+        BOOST_TEST( v.valid() );
+        BOOST_TEST_EQ( v->version(), 4 );
+        BOOST_TEST_EQ( v->ihl(), 5 );
+        BOOST_TEST_EQ( v->total_length.value(), 44 );
+        BOOST_TEST_EQ( v->identification.value(), 0x1234 );
+        BOOST_TEST_EQ( v->flags(), 2 );
+        BOOST_TEST_EQ( v->fragment_offset(), 0 );
+        BOOST_TEST_EQ( v->ttl.value(), 64 );
+        BOOST_TEST_EQ( v->protocol.value(), ip_protocol_tcp );
+        BOOST_TEST_EQ( v->source.value(), 0xC0A80001u );
+        BOOST_TEST_EQ( v.header_size(), 20u );
+        BOOST_TEST( v.payload() == ipv4_tcp + 34 );
+        BOOST_TEST_EQ( v.payload_size(), sizeof( ipv4_tcp ) - 34 );
+
+        BOOST_TEST( !( header_view<ipv4_header>( ipv4_tcp + 14, 19 ).valid() ) );
+        BOOST_TEST( !( header_view<ipv4_header>( ipv4_tcp, sizeof( ipv4_tcp ) ).valid() ) );
+    }
+
+    {
+        // options make the header longer than the data
+
+        unsigned char h[ 24 ] = { 0x46 };
+
+        BOOST_TEST( ( header_view<ipv4_header>( h, 24 ).valid() ) );
+        BOOST_TEST( !( header_view<ipv4_header>( h, 23 ).valid() ) );
+
+        h[ 0 ] = 0x44;
+
+        BOOST_TEST( !( header_view<ipv4_header>( h, 24 ).valid() ) );
+    }
+
+    {
+        // rewriting in place
+
+        unsigned char h[ 8 ] = {};
+
+        header_view<udp_header, unsigned char> v( h, 8 );
+
+        BOOST_TEST( v.valid() );
+
+        v->destination_port = 53;
+
+        BOOST_TEST_EQ( h[ 2 ], 0 );
+        BOOST_TEST_EQ( h[ 3 ], 53 );
+    }
+
+    // parse_packet
+
+    {
+        parsed_packet r;
+
+        BOOST_TEST( parse_packet( r, ipv4_tcp, sizeof( ipv4_tcp ) ) );
+
+        BOOST_TEST( r.ethernet == reinterpret_cast<ethernet_header const*>( ipv4_tcp ) );
+        BOOST_TEST( r.vlan == 0 );
+        BOOST_TEST( r.ipv4 != 0 );
+        BOOST_TEST( r.ipv6 == 0 );
+        BOOST_TEST( r.tcp != 0 );
+        BOOST_TEST( r.udp == 0 );
+
+        BOOST_TEST_EQ( r.tcp->source_port.value(), 12345 );
+        BOOST_TEST_EQ( r.tcp->destination_port.value(), 80 );
+        BOOST_TEST_EQ( r.tcp->data_offset(), 5 );
+        BOOST_TEST_EQ( r.tcp->flags(), 0x18 );
+
+        BOOST_TEST( r.payload == ipv4_tcp + 54 );
+        BOOST_TEST_EQ( r.payload_size, 4u );
+
+        // truncated TCP header
+
+        BOOST_TEST( !parse_packet( r, ipv4_tcp, 50 ) );
+        BOOST_TEST( r.ipv4 != 0 );
+        BOOST_TEST( r.tcp == 0 );
+    }
+
+    {
+        parsed_packet r;
+
+        BOOST_TEST( parse_packet( r, vlan_ipv6_udp, sizeof( vlan_ipv6_udp ) ) );
+
+        BOOST_TEST( r.vlan != 0 );
+        BOOST_TEST_EQ( r.vlan->priority(), 5 );
+        BOOST_TEST_EQ( r.vlan->vlan_id(), 100 );
+
+        BOOST_TEST( r.ipv6 != 0 );
+        BOOST_TEST_EQ( r.ipv6->version(), 6u );
+        BOOST_TEST_EQ( r.ipv6->traffic_class(), 1u );
+        BOOST_TEST_EQ( r.ipv6->flow_label(), 0x23456u );
+
+        BOOST_TEST( r.udp != 0 );
+        BOOST_TEST_EQ( r.udp->destination_port.value(), 53 );
+
+        BOOST_TEST_EQ( r.payload_size, 3u );
+        BOOST_TEST_EQ( r.payload[ 0 ], 'x' );
+    }
+
+    {
+        // unknown ether type
+
+        unsigned char frame[ 20 ] = {};
+
+        frame[ 12 ] = 0x08;
+        frame[ 13 ] = 0x06;
+
+        parsed_packet r;
+
+        BOOST_TEST( parse_packet( r, frame, 20 ) );
+        BOOST_TEST( r.ethernet != 0 );
+        BOOST_TEST( r.ipv4 == 0 );
+        BOOST_TEST_EQ( r.payload_size, 6u );
+
+        BOOST_TEST( !parse_packet( r, frame, 13 ) );
+        BOOST_TEST( r.ethernet == 0 );
+    }
+
+    // parse_packets
+
+    {
+        unsigned char const * packets[ 10 ];
+        std::size_t sizes[ 10 ];
+
+        for( int i = 0; i < 10; ++i )
+        {
+            packets[ i ] = i % 2? vlan_ipv6_udp: ipv4_tcp;
+            sizes[ i ] = i % 2? sizeof( vlan_ipv6_udp ): sizeof( ipv4_tcp );
+        }
+
+        sizes[ 4 ] = 40;
+
+        parsed_packet out[ 10 ];
+
+        BOOST_TEST_EQ( parse_packets( out, packets, sizes, 10 ), 9u );
+
+        for( int i = 0; i < 10; ++i )
+        {
+            if( i == 4 )
+            {
+                BOOST_TEST( out[ i ].tcp == 0 );
+            }
+            else
+            {
+                BOOST_TEST( i % 2? out[ i ].udp != 0: out[ i ].tcp != 0 );
+            }
+        }
+    }
+
+    return boost::report_errors();
+}
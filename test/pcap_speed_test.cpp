@@ -0,0 +1,198 @@
+//  pcap_speed_test.cpp  -------------------------------------------------------------//
+
+//  Copyright 2026 Julien Blanc
+
+//  Distributed under the Boost Software License, Version 1.0.
+//  http://www.boost.org/LICENSE_1_0.txt
+
+//--------------------------------------------------------------------------------------//
+
+//  Throughput of the pcap reader of example/pcap_reader.hpp, which dispatches once
+//  on the byte order of the capture, compared to a loop that passes every field
+//  through conditional_reverse( x, file_order, order::native ).
+//
+//  Usage: pcap_speed_test [megabytes [passes [file]]]
+//
+//  A synthetic capture of the given size (default 1024 MB) is written, once in
+//  each byte order, to a temporary file (default pcap_speed_test.pcap in the
+//  current directory), which is then memory mapped and read in place, as
+//  pcap_dump does. The file is removed at the end.
+
+#include <boost/endian/detail/disable_warnings.hpp>
+
+#include "../example/pcap_reader.hpp"
+#include "../example/file_view.hpp"
+#include <boost/endian/conversion.hpp>
+#include <chrono>
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstddef>
+
+using namespace boost::endian;
+
+namespace
+{
+  void put_u16( std::vector<unsigned char> & v, std::uint16_t x, order o )
+  {
+    unsigned char b[ 2 ];
+
+    if( o == order::big ) store_big_u16( b, x ); else store_little_u16( b, x );
+
+    v.insert( v.end(), b, b + 2 );
+  }
+
+  void put_u32( std::vector<unsigned char> & v, std::uint32_t x, order o )
+  {
+    unsigned char b[ 4 ];
+
+    if( o == order::big ) store_big_u32( b, x ); else store_little_u32( b, x );
+
+    v.insert( v.end(), b, b + 4 );
+  }
+
+  std::vector<unsigned char> make_capture( order o, std::size_t size )
+  {
+    std::vector<unsigned char> v;
+    v.reserve( size + 2048 );
+
+    put_u32( v, 0xA1B2C3D4, o );
+    put_u16( v, 2, o );
+    put_u16( v, 4, o );
+    put_u32( v, 0, o );
+    put_u32( v, 0, o );
+    put_u32( v, 65535, o );
+    put_u32( v, 1, o );
+
+    std::uint32_t x = 1;
+    std::uint32_t t = 0;
+
+    while( v.size() < size )
+    {
+      x = x * 1664525u + 1013904223u;
+
+      std::uint32_t len = 60 + ( x >> 22 ) % 1455;
+
+      put_u32( v, t / 1000000, o );
+      put_u32( v, t % 1000000, o );
+      put_u32( v, len, o );
+      put_u32( v, len, o );
+
+      v.resize( v.size() + len, static_cast<unsigned char>( x ) );
+
+      t += 17;
+    }
+
+    return v;
+  }
+
+  // the loop as it is written with the runtime order API
+
+  std::uint64_t runtime_order( unsigned char const * p, std::size_t size )
+  {
+    unsigned char const * end = p + size;
+
+    order o = load_little_u32( p ) == 0xA1B2C3D4? order::little: order::big;
+
+    std::uint64_t sum = 0;
+
+    p += 24;
+
+    while( end - p >= 16 )
+    {
+      std::uint32_t f[ 4 ];
+      std::memcpy( f, p, 16 );
+
+      std::uint32_t ts_sec = conditional_reverse( f[ 0 ], o, order::native );
+      std::uint32_t ts_frac = conditional_reverse( f[ 1 ], o, order::native );
+      std::uint32_t caplen = conditional_reverse( f[ 2 ], o, order::native );
+      std::uint32_t origlen = conditional_reverse( f[ 3 ], o, order::native );
+
+      p += 16;
+
+      if( caplen > static_cast<std::size_t>( end - p ) ) break;
+
+      sum += ts_sec + ts_frac + caplen + origlen + p[ 0 ];
+
+      p += caplen;
+    }
+
+    return sum;
+  }
+
+  struct accumulate
+  {
+    std::uint64_t * sum;
+
+    void operator()( pcap::packet const & pk ) const
+    {
+      *sum += pk.ts_sec + pk.ts_frac + pk.captured_length + pk.original_length + pk.data[ 0 ];
+    }
+  };
+
+  std::uint64_t dispatched_order( unsigned char const * p, std::size_t size )
+  {
+    std::uint64_t sum = 0;
+
+    accumulate f = { &sum };
+    pcap::for_each_packet( p, size, f );
+
+    return sum;
+  }
+
+  template<class F> void time( char const * name, F f, file_view const & v, int passes )
+  {
+    std::uint64_t sum = 0;
+
+    std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+
+    for( int i = 0; i < passes; ++i )
+    {
+      sum += f( v.data(), v.size() );
+    }
+
+    std::chrono::steady_clock::time_point t2 = std::chrono::steady_clock::now();
+
+    double s = std::chrono::duration<double>( t2 - t1 ).count();
+
+    std::cout << "  " << name << ": " << static_cast<double>( v.size() ) * passes / s / 1e9 << " GB/s (" << sum << ")\n";
+  }
+}
+
+int main( int argc, char * argv[] )
+{
+  std::size_t mb = argc > 1? std::strtoul( argv[1], 0, 10 ): 1024;
+  int passes = argc > 2? std::atoi( argv[2] ): 3;
+  char const * path = argc > 3? argv[3]: "pcap_speed_test.pcap";
+
+  for( int i = 0; i < 2; ++i )
+  {
+    order o = i == 0? order::little: order::big;
+
+    {
+      std::vector<unsigned char> v = make_capture( o, mb << 20 );
+
+      std::ofstream os( path, std::ios::binary | std::ios::trunc );
+      os.write( reinterpret_cast<char const *>( v.data() ), static_cast<std::streamsize>( v.size() ) );
+
+      if( !os.flush() )
+      {
+        std::cerr << "cannot write " << path << "\n";
+        return 1;
+      }
+    }
+
+    file_view v( path );
+
+    std::cout << ( o == order::little? "little": "big" ) << " endian capture, " << v.size() / 1048576 << " MB, " << ( v.mapped()? "mapped": "read" ) << "\n";
+
+    time( "conditional_reverse per field", runtime_order, v, passes );
+    time( "order dispatched once        ", dispatched_order, v, passes );
+  }
+
+  std::remove( path );
+}
@@ -0,0 +1,142 @@
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/pcm.hpp>
+#include <boost/endian/buffers.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <limits>
+#include <cstdint>
+#include <cstddef>
+
+template<std::size_t N, boost::endian::order Order> void test( std::size_t channels )
+{
+    using namespace boost::endian;
+
+    std::size_t const frames = 19;
+
+    std::int32_t const top = static_cast<std::int32_t>( ( std::uint32_t( 1 ) << ( N * 8 - 1 ) ) - 1 );
+
+    unsigned char src[ frames * 5 * N ];
+    std::int32_t expected[ frames * 5 ];
+
+    std::uint32_t x = 7;
+
+    for( std::size_t i = 0; i < frames * channels; ++i )
+    {
+        x = x * 1664525u + 1013904223u;
+
+        std::int32_t v = static_cast<std::int32_t>( static_cast<std::int64_t>( x >> ( 32 - N * 8 ) ) - top - 1 );
+
+        if( i == 0 ) v = top;
+        if( i == 1 ) v = -top - 1;
+
+        expected[ i ] = v;
+        endian_store<std::int32_t, N, Order>( src + i * N, v );
+    }
+
+    std::int32_t ibuf[ 5 ][ frames ];
+    float fbuf[ 5 ][ frames ];
+
+    std::int32_t * ip[ 5 ];
+    float * fp[ 5 ];
+
+    for( std::size_t c = 0; c < 5; ++c )
+    {
+        ip[ c ] = ibuf[ c ];
+        fp[ c ] = fbuf[ c ];
+    }
+
+    pcm_deinterleave<N, Order>( ip, src, frames, channels );
+    pcm_deinterleave<N, Order>( fp, src, frames, channels );
+
+    for( std::size_t i = 0; i < frames; ++i )
+    {
+        for( std::size_t c = 0; c < channels; ++c )
+        {
+            std::int32_t const v = expected[ i * channels + c ];
+
+            BOOST_TEST_EQ( ibuf[ c ][ i ], v );
+            BOOST_TEST_EQ( fbuf[ c ][ i ], static_cast<float>( v ) / ( static_cast<float>( top ) + 1.0f ) );
+        }
+    }
+
+    unsigned char dst[ frames * 5 * N ];
+
+    pcm_interleave<N, Order>( dst, ip, frames, channels );
+
+    for( std::size_t i = 0; i < frames * channels * N; ++i )
+    {
+        BOOST_TEST_EQ( dst[ i ], src[ i ] );
+    }
+
+    if( N <= 3 )
+    {
+        // float round trip is exact when the sample fits in the mantissa
+
+        for( std::size_t i = 0; i < frames * channels * N; ++i ) dst[ i ] = 0;
+
+        pcm_interleave<N, Order>( dst, fp, frames, channels );
+
+        for( std::size_t i = 0; i < frames * channels * N; ++i )
+        {
+            BOOST_TEST_EQ( dst[ i ], src[ i ] );
+        }
+    }
+}
+
+template<std::size_t N, boost::endian::order Order> void test()
+{
+    for( std::size_t c = 1; c <= 5; ++c )
+    {
+        test<N, Order>( c );
+    }
+}
+
+int main()
+{
+    using namespace boost::endian;
+
+    test<3, order::big>();
+    test<3, order::little>();
+    test<2, order::little>();
+    test<1, order::big>();
+    test<4, order::little>();
+
+    // clamping and rounding
+
+    {
+        float const left[] = { 1.0f, -1.0f, 2.0f, -2.0f, 0.4f / 8388608.0f, 0.6f / 8388608.0f };
+        float const * planes[] = { left };
+
+        big_int24_buf_t out[ 6 ];
+
+        pcm_interleave<3, order::big>( out[ 0 ].data(), planes, 6, 1 );
+
+        BOOST_TEST_EQ( out[ 0 ].value(), 8388607 );
+        BOOST_TEST_EQ( out[ 1 ].value(), -8388608 );
+        BOOST_TEST_EQ( out[ 2 ].value(), 8388607 );
+        BOOST_TEST_EQ( out[ 3 ].value(), -8388608 );
+        BOOST_TEST_EQ( out[ 4 ].value(), 0 );
+        BOOST_TEST_EQ( out[ 5 ].value(), 1 );
+    }
+
+    // NaN
+
+    {
+        float const left[] = { std::numeric_limits<float>::quiet_NaN(), -std::numeric_limits<float>::quiet_NaN() };
+        float const * planes[] = { left };
+
+        little_int32_buf_t out[ 2 ];
+
+        out[ 0 ] = 1;
+        out[ 1 ] = 1;
+
+        pcm_interleave<4, order::little>( out[ 0 ].data(), planes, 2, 1 );
+
+        BOOST_TEST_EQ( out[ 0 ].value(), 0 );
+        BOOST_TEST_EQ( out[ 1 ].value(), 0 );
+    }
+
+    return boost::report_errors();
+}
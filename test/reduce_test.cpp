@@ -0,0 +1,185 @@
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/reduce.hpp>
+#include <boost/endian/buffers.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <type_traits>
+#include <utility>
+#include <limits>
+#include <cstdint>
+#include <cstddef>
+
+template<class T, std::size_t N, boost::endian::order Order> void test_integral()
+{
+    using namespace boost::endian;
+
+    // 1 .. 11 elements, to exercise both the unrolled and the remainder loops
+
+    for( std::size_t n = 1; n <= 11; ++n )
+    {
+        unsigned char buffer[ 11 * N ];
+
+        std::int64_t sum = 0;
+        T lo = 0, hi = 0;
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            T x = static_cast<T>( ( i * 37 ) % 23 );
+
+            if( std::is_signed<T>::value && i % 3 == 1 )
+            {
+                x = static_cast<T>( -x );
+            }
+
+            endian_store<T, N, Order>( buffer + i * N, x );
+
+            sum += static_cast<std::int64_t>( x );
+
+            if( i == 0 || x < lo ) lo = x;
+            if( i == 0 || hi < x ) hi = x;
+        }
+
+        BOOST_TEST_EQ( static_cast<std::int64_t>( endian_sum<T, N, Order>( buffer, n ) ), sum );
+
+        BOOST_TEST_EQ( (endian_min<T, N, Order>( buffer, n )), lo );
+        BOOST_TEST_EQ( (endian_max<T, N, Order>( buffer, n )), hi );
+
+        std::pair<T, T> mm = endian_minmax<T, N, Order>( buffer, n );
+
+        BOOST_TEST_EQ( mm.first, lo );
+        BOOST_TEST_EQ( mm.second, hi );
+    }
+}
+
+int main()
+{
+    using namespace boost::endian;
+
+    test_integral<std::int16_t, 2, order::big>();
+    test_integral<std::int16_t, 2, order::little>();
+    test_integral<std::uint16_t, 2, order::big>();
+    test_integral<std::int32_t, 3, order::big>();
+    test_integral<std::int32_t, 3, order::little>();
+    test_integral<std::uint32_t, 4, order::big>();
+    test_integral<std::int32_t, 4, order::little>();
+    test_integral<std::int64_t, 5, order::big>();
+    test_integral<std::int64_t, 8, order::big>();
+    test_integral<std::uint64_t, 8, order::little>();
+
+    // widened accumulator
+
+    {
+        big_uint16_buf_t v[ 5 ];
+
+        for( int i = 0; i < 5; ++i ) v[ i ] = 0xFFFF;
+
+        BOOST_TEST_EQ( endian_sum( v, 5 ), 5u * 0xFFFF );
+    }
+
+    {
+        big_int32_buf_t v[ 3 ];
+
+        v[ 0 ] = 0x7FFFFFFF;
+        v[ 1 ] = 0x7FFFFFFF;
+        v[ 2 ] = -1;
+
+        BOOST_TEST_EQ( endian_sum( v, 3 ), 2 * static_cast<std::int64_t>( 0x7FFFFFFF ) - 1 );
+
+        BOOST_TEST_EQ( endian_min( v, 3 ), -1 );
+        BOOST_TEST_EQ( endian_max( v, 3 ), 0x7FFFFFFF );
+    }
+
+    // 64-bit sums near and past the limit
+
+    {
+        big_int64_buf_t v[ 5 ];
+
+        std::int64_t const m = ( std::numeric_limits<std::int64_t>::max )();
+
+        v[ 0 ] = m;
+        v[ 1 ] = -1;
+        v[ 2 ] = m;
+        v[ 3 ] = -m;
+        v[ 4 ] = -m;
+
+        BOOST_TEST_EQ( endian_sum( v, 5 ), -1 );
+
+        v[ 1 ] = 1;
+
+        BOOST_TEST_EQ( endian_sum( v, 2 ), ( std::numeric_limits<std::int64_t>::min )() );
+    }
+
+    // floating point
+
+    {
+        big_float64_buf_t v[ 4 ];
+
+        v[ 0 ] = 1.5;
+        v[ 1 ] = -2.0;
+        v[ 2 ] = 4.0;
+        v[ 3 ] = 0.5;
+
+        BOOST_TEST_EQ( endian_sum( v, 4 ), 4.0 );
+        BOOST_TEST_EQ( endian_min( v, 4 ), -2.0 );
+        BOOST_TEST_EQ( endian_max( v, 4 ), 4.0 );
+    }
+
+    // statistics
+
+    {
+        little_int32_buf_t v[ 8 ];
+
+        int const x[ 8 ] = { 2, 4, 4, 4, 5, 5, 7, 9 };
+
+        for( int i = 0; i < 8; ++i ) v[ i ] = 1000000 + x[ i ];
+
+        endian_statistics st = endian_stats( v, 8 );
+
+        BOOST_TEST_EQ( st.count, 8u );
+        BOOST_TEST_EQ( st.mean, 1000005.0 );
+        BOOST_TEST_EQ( st.variance, 4.0 );
+    }
+
+    {
+        endian_statistics st = endian_stats<std::uint16_t, 2, order::big>( 0, 0 );
+
+        BOOST_TEST_EQ( st.count, 0u );
+        BOOST_TEST_EQ( st.mean, 0.0 );
+        BOOST_TEST_EQ( st.variance, 0.0 );
+    }
+
+    // popcount
+
+    {
+        unsigned char v[ 19 ];
+
+        std::size_t expected = 0;
+
+        for( int i = 0; i < 19; ++i )
+        {
+            v[ i ] = static_cast<unsigned char>( i * 29 + 3 );
+
+            for( int j = 0; j < 8; ++j )
+            {
+                expected += ( v[ i ] >> j ) & 1;
+            }
+        }
+
+        BOOST_TEST_EQ( endian_popcount( v, 19 ), expected );
+        BOOST_TEST_EQ( endian_popcount( v, 0 ), 0u );
+    }
+
+    {
+        big_uint32_buf_t v[ 3 ];
+
+        v[ 0 ] = 0xFFFFFFFF;
+        v[ 1 ] = 0x01010101;
+        v[ 2 ] = 0;
+
+        BOOST_TEST_EQ( endian_popcount( v, 3 ), 36u );
+    }
+
+    return boost::report_errors();
+}
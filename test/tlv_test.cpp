@@ -0,0 +1,128 @@
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/tlv.hpp>
+#include <boost/endian/detail/endian_store.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+template<std::size_t TypeWidth, std::size_t LenWidth, boost::endian::order Order> void test()
+{
+    using namespace boost::endian;
+
+    typedef tlv_range<TypeWidth, LenWidth, Order> range;
+
+    std::vector<unsigned char> data;
+    std::vector<std::size_t> offsets;
+    std::vector<std::size_t> lengths;
+
+    for( std::size_t i = 0; i < 100; ++i )
+    {
+        std::size_t const length = ( i * 37 ) % 50;
+
+        offsets.push_back( data.size() );
+        lengths.push_back( length );
+
+        unsigned char h[ TypeWidth + LenWidth ];
+
+        endian_store<std::uint64_t, TypeWidth, Order>( h, i + 1 );
+        endian_store<std::uint64_t, LenWidth, Order>( h + TypeWidth, length );
+
+        data.insert( data.end(), h, h + TypeWidth + LenWidth );
+
+        for( std::size_t j = 0; j < length; ++j ) data.push_back( static_cast<unsigned char>( i ) );
+    }
+
+    {
+        range r( data.data(), data.size() );
+
+        BOOST_TEST( r.ok() );
+
+        std::size_t i = 0;
+
+        for( typename range::iterator it = r.begin(); it != r.end(); ++it, ++i )
+        {
+            tlv_record const x = *it;
+
+            BOOST_TEST_EQ( x.type, i + 1 );
+            BOOST_TEST_EQ( x.length, lengths[ i ] );
+            BOOST_TEST_EQ( x.offset, offsets[ i ] );
+            BOOST_TEST( x.value == data.data() + offsets[ i ] + TypeWidth + LenWidth );
+
+            if( x.length != 0 ) BOOST_TEST_EQ( x.value[ x.length - 1 ], i );
+        }
+
+        BOOST_TEST_EQ( i, 100u );
+
+        std::vector<std::size_t> index;
+
+        BOOST_TEST( r.build_index( index ) );
+        BOOST_TEST( index == offsets );
+
+        tlv_record const x = r.record_at( index[ 57 ] );
+
+        BOOST_TEST_EQ( x.type, 58u );
+        BOOST_TEST_EQ( x.length, lengths[ 57 ] );
+    }
+
+    // truncated in the value, then in the header of the last record
+
+    for( std::size_t cut = 1; cut < TypeWidth + LenWidth + lengths.back(); ++cut )
+    {
+        range r( data.data(), data.size() - cut );
+
+        BOOST_TEST( !r.ok() );
+        BOOST_TEST_EQ( r.valid_size(), offsets.back() );
+
+        std::size_t n = 0;
+        for( tlv_record x: r ) { (void)x; ++n; }
+
+        BOOST_TEST_EQ( n, 99u );
+
+        std::vector<std::size_t> index;
+
+        BOOST_TEST( !r.build_index( index ) );
+        BOOST_TEST_EQ( index.size(), 99u );
+    }
+
+    // a length running past the end
+
+    {
+        std::vector<unsigned char> bad( data.begin(), data.begin() + offsets[ 10 ] + TypeWidth + LenWidth );
+
+        endian_store<std::uint64_t, LenWidth, Order>( &bad[ offsets[ 10 ] + TypeWidth ], 1 );
+
+        range r( bad.data(), bad.size() );
+
+        BOOST_TEST_EQ( r.valid_size(), offsets[ 10 ] );
+    }
+
+    {
+        range r( data.data(), 0 );
+
+        BOOST_TEST( r.ok() );
+        BOOST_TEST( r.begin() == r.end() );
+    }
+}
+
+template<std::size_t TypeWidth, std::size_t LenWidth> void test2()
+{
+    test<TypeWidth, LenWidth, boost::endian::order::big>();
+    test<TypeWidth, LenWidth, boost::endian::order::little>();
+}
+
+int main()
+{
+    test2<1, 1>();
+    test2<1, 2>();
+    test2<2, 2>();
+    test2<2, 4>();
+    test2<1, 3>();
+    test2<4, 4>();
+    test2<3, 8>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,186 @@
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/utf.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+using namespace boost::endian;
+
+// "Hello, world! " U+00E9 U+20AC U+1F600 "abcdefgh"
+
+static char const utf8[] = "Hello, world! \xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80" "abcdefgh";
+
+static std::uint32_t const utf32[] =
+{
+    'H', 'e', 'l', 'l', 'o', ',', ' ', 'w', 'o', 'r', 'l', 'd', '!', ' ',
+    0xE9, 0x20AC, 0x1F600,
+    'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h'
+};
+
+static std::size_t const n32 = sizeof( utf32 ) / sizeof( utf32[ 0 ] );
+static std::size_t const n16 = n32 + 1;
+static std::size_t const n8 = sizeof( utf8 ) - 1;
+
+template<order Order> void test()
+{
+    // reference encodings
+
+    unsigned char u32[ n32 * 4 ];
+    unsigned char u16[ n16 * 2 ];
+    char16_t native16[ n16 ];
+
+    {
+        std::size_t j = 0;
+
+        for( std::size_t i = 0; i < n32; ++i )
+        {
+            endian_store<std::uint32_t, 4, Order>( u32 + 4 * i, utf32[ i ] );
+
+            if( utf32[ i ] < 0x10000 )
+            {
+                native16[ j++ ] = static_cast<char16_t>( utf32[ i ] );
+            }
+            else
+            {
+                native16[ j++ ] = 0xD83D;
+                native16[ j++ ] = 0xDE00;
+            }
+        }
+
+        for( std::size_t i = 0; i < n16; ++i )
+        {
+            endian_store<std::uint16_t, 2, Order>( u16 + 2 * i, native16[ i ] );
+        }
+    }
+
+    // decoders
+
+    {
+        char out[ n16 * 3 ];
+
+        utf_result r = utf16_to_utf8<Order>( out, u16, n16 );
+
+        BOOST_TEST( r.ok );
+        BOOST_TEST_EQ( r.read, n16 );
+        BOOST_TEST_EQ( r.written, n8 );
+        BOOST_TEST( std::memcmp( out, utf8, n8 ) == 0 );
+
+        r = utf32_to_utf8<Order>( out, u32, n32 );
+
+        BOOST_TEST( r.ok );
+        BOOST_TEST_EQ( r.written, n8 );
+        BOOST_TEST( std::memcmp( out, utf8, n8 ) == 0 );
+    }
+
+    {
+        char16_t out[ n32 * 2 ];
+
+        utf_result r = utf16_to_native<Order>( out, u16, n16 );
+
+        BOOST_TEST( r.ok );
+        BOOST_TEST_EQ( r.written, n16 );
+        BOOST_TEST( std::memcmp( out, native16, sizeof( native16 ) ) == 0 );
+
+        r = utf32_to_utf16<Order>( out, u32, n32 );
+
+        BOOST_TEST( r.ok );
+        BOOST_TEST_EQ( r.written, n16 );
+        BOOST_TEST( std::memcmp( out, native16, sizeof( native16 ) ) == 0 );
+    }
+
+    // encoders
+
+    {
+        unsigned char out[ n8 * 4 ];
+
+        utf_result r = utf8_to_utf16<Order>( out, utf8, n8 );
+
+        BOOST_TEST( r.ok );
+        BOOST_TEST_EQ( r.read, n8 );
+        BOOST_TEST_EQ( r.written, n16 );
+        BOOST_TEST( std::memcmp( out, u16, sizeof( u16 ) ) == 0 );
+
+        r = utf8_to_utf32<Order>( out, utf8, n8 );
+
+        BOOST_TEST( r.ok );
+        BOOST_TEST_EQ( r.written, n32 );
+        BOOST_TEST( std::memcmp( out, u32, sizeof( u32 ) ) == 0 );
+
+        r = native_to_utf16<Order>( out, native16, n16 );
+
+        BOOST_TEST( r.ok );
+        BOOST_TEST( std::memcmp( out, u16, sizeof( u16 ) ) == 0 );
+    }
+
+    // invalid input
+
+    {
+        char out[ 64 ];
+        char16_t out16[ 16 ];
+        unsigned char bad[ 16 ];
+
+        // lone high surrogate at the end, after four ASCII units
+
+        for( int i = 0; i < 4; ++i ) endian_store<std::uint16_t, 2, Order>( bad + 2 * i, 'x' );
+        endian_store<std::uint16_t, 2, Order>( bad + 8, 0xD800 );
+
+        utf_result r = utf16_to_utf8<Order>( out, bad, 5 );
+
+        BOOST_TEST( !r.ok );
+        BOOST_TEST_EQ( r.read, 4u );
+        BOOST_TEST_EQ( r.written, 4u );
+
+        BOOST_TEST( !utf16_to_native<Order>( out16, bad, 5 ).ok );
+
+        // lone low surrogate
+
+        endian_store<std::uint16_t, 2, Order>( bad + 8, 0xDC00 );
+        endian_store<std::uint16_t, 2, Order>( bad + 10, 'y' );
+
+        BOOST_TEST( !( utf16_to_utf8<Order>( out, bad, 6 ).ok ) );
+
+        // high surrogate followed by a non-surrogate
+
+        endian_store<std::uint16_t, 2, Order>( bad + 8, 0xD800 );
+
+        BOOST_TEST( !( utf16_to_native<Order>( out16, bad, 6 ).ok ) );
+
+        // UTF-32 out of range, surrogate
+
+        endian_store<std::uint32_t, 4, Order>( bad, 0x110000 );
+        BOOST_TEST( !( utf32_to_utf8<Order>( out, bad, 1 ).ok ) );
+
+        endian_store<std::uint32_t, 4, Order>( bad, 0xDFFF );
+        BOOST_TEST( !( utf32_to_utf16<Order>( out16, bad, 1 ).ok ) );
+
+        // UTF-8: overlong, surrogate, truncated, stray continuation, too large
+
+        char const * const invalid[] = { "\xC0\xAF", "\xE0\x80\xAF", "\xED\xA0\x80", "\xE2\x82", "\x80", "\xF4\x90\x80\x80", "\xF8\x88\x80\x80\x80" };
+
+        for( std::size_t i = 0; i < sizeof( invalid ) / sizeof( invalid[ 0 ] ); ++i )
+        {
+            utf_result r2 = utf8_to_utf16<Order>( bad, invalid[ i ], std::strlen( invalid[ i ] ) );
+
+            BOOST_TEST( !r2.ok );
+            BOOST_TEST_EQ( r2.read, 0u );
+
+            BOOST_TEST( !( utf8_to_utf32<Order>( bad, invalid[ i ], std::strlen( invalid[ i ] ) ).ok ) );
+        }
+
+        char16_t const lone[] = { 'a', 0xDBFF };
+
+        BOOST_TEST( !( native_to_utf16<Order>( bad, lone, 2 ).ok ) );
+    }
+}
+
+int main()
+{
+    test<order::big>();
+    test<order::little>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,182 @@
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/validate.hpp>
+#include <boost/endian/buffers.hpp>
+#include <boost/endian/detail/endian_store.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+
+enum class color: std::uint16_t
+{
+    red = 1, green, blue
+};
+
+enum class opcode: std::int32_t
+{
+    nop = 0, load = 3, store = 5, jump = 40
+};
+
+struct bit1
+{
+    int operator()( std::uint8_t x ) const
+    {
+        return x & 2;
+    }
+};
+
+// stores values[ i ] and checks the loaded array, the first bad index and
+// the mask against the predicate applied directly
+
+template<class T, std::size_t N, boost::endian::order Order, class V> void test( T const * values, std::size_t n, V v )
+{
+    using namespace boost::endian;
+
+    unsigned char src[ 200 * N ];
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        endian_store<T, N, Order>( src + i * N, values[ i ] );
+    }
+
+    std::size_t first = n;
+    for( std::size_t i = 0; i < n; ++i ) if( !v( values[ i ] ) ) { first = i; break; }
+
+    {
+        T dst[ 200 ];
+
+        BOOST_TEST_EQ( ( endian_validate<T, N, Order>( dst, src, n, v ) ), first );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            BOOST_TEST( dst[ i ] == values[ i ] );
+        }
+    }
+
+    {
+        T dst[ 200 ];
+        std::uint64_t mask[ 4 ];
+
+        BOOST_TEST_EQ( ( endian_validate<T, N, Order>( dst, src, n, v, mask ) ), first );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            BOOST_TEST( dst[ i ] == values[ i ] );
+            BOOST_TEST_EQ( ( mask[ i / 64 ] >> ( i % 64 ) ) & 1, v( values[ i ] )? 1u: 0u );
+        }
+
+        if( n % 64 != 0 )
+        {
+            BOOST_TEST_EQ( mask[ n / 64 ] >> ( n % 64 ), 0u );
+        }
+    }
+}
+
+template<class T, std::size_t N, class V> void test2( T const * values, std::size_t n, V v )
+{
+    test<T, N, boost::endian::order::little>( values, n, v );
+    test<T, N, boost::endian::order::big>( values, n, v );
+}
+
+int main()
+{
+    using namespace boost::endian;
+
+    // scoped enum, range
+
+    {
+        color values[ 150 ];
+
+        for( std::size_t i = 0; i < 150; ++i ) values[ i ] = static_cast<color>( 1 + i % 3 );
+
+        range_validator<color> const v( color::red, color::blue );
+
+        for( std::size_t n = 0; n <= 150; n += 7 )
+        {
+            test2<color, 2>( values, n, v );
+        }
+
+        values[ 100 ] = static_cast<color>( 4 );
+        values[ 130 ] = static_cast<color>( 0 );
+
+        test2<color, 2>( values, 150, v );
+        test2<color, 2>( values, 101, v );
+        test2<color, 2>( values, 100, v );
+    }
+
+    // integers of odd width, range with negative bounds
+
+    {
+        std::int32_t values[ 70 ];
+
+        for( std::size_t i = 0; i < 70; ++i ) values[ i ] = static_cast<std::int32_t>( i ) * 1000 - 35000;
+
+        test2<std::int32_t, 3>( values, 70, range_validator<std::int32_t>( -35000, 34000 ) );
+        test2<std::int32_t, 3>( values, 70, range_validator<std::int32_t>( -20000, 50000 ) );
+        test2<std::int32_t, 3>( values, 70, range_validator<std::int32_t>( -40000, 0 ) );
+    }
+
+    // sparse enum, bitset and table
+
+    {
+        std::uint64_t const bits[] = { ( 1u << 0 ) | ( 1u << 3 ) | ( 1u << 5 ), std::uint64_t( 0 ) };
+        std::uint64_t bits2[] = { bits[ 0 ] };
+
+        bits2[ 0 ] |= std::uint64_t( 1 ) << 40;
+
+        unsigned char table[ 41 ] = {};
+        table[ 0 ] = table[ 3 ] = table[ 5 ] = table[ 40 ] = 1;
+
+        opcode values[ 80 ];
+
+        for( std::size_t i = 0; i < 80; ++i )
+        {
+            static opcode const ops[] = { opcode::nop, opcode::load, opcode::store, opcode::jump };
+            values[ i ] = ops[ i % 4 ];
+        }
+
+        test2<opcode, 4>( values, 80, bitset_validator( bits2, 64 ) );
+        test2<opcode, 4>( values, 80, table_validator( table, 41 ) );
+
+        // jump is not in the first bitset
+        test2<opcode, 4>( values, 80, bitset_validator( bits, 128 ) );
+
+        values[ 66 ] = static_cast<opcode>( -3 );
+
+        test2<opcode, 4>( values, 80, bitset_validator( bits2, 64 ) );
+        test2<opcode, 4>( values, 80, table_validator( table, 41 ) );
+    }
+
+    // endian_buffer arrays
+
+    {
+        big_uint16_buf_t const src[] = { big_uint16_buf_t( 10 ), big_uint16_buf_t( 20 ), big_uint16_buf_t( 300 ) };
+
+        std::uint16_t dst[ 3 ];
+
+        BOOST_TEST_EQ( endian_validate( dst, src, 3, range_validator<std::uint16_t>( 0, 255 ) ), 2u );
+        BOOST_TEST_EQ( dst[ 2 ], 300 );
+
+        std::uint64_t mask[ 1 ];
+
+        BOOST_TEST_EQ( endian_validate( dst, src, 2, range_validator<std::uint16_t>( 0, 255 ), mask ), 2u );
+        BOOST_TEST_EQ( mask[ 0 ], 3u );
+    }
+
+    // a predicate returning an int other than 0 or 1
+
+    {
+        std::uint8_t const src[] = { 2, 1, 2, 1, 6, 4 };
+
+        std::uint8_t dst[ 6 ];
+        std::uint64_t mask[ 1 ];
+
+        BOOST_TEST_EQ( ( endian_validate<std::uint8_t, 1, order::big>( dst, src, 6, bit1(), mask ) ), 1u );
+        BOOST_TEST_EQ( mask[ 0 ], 0x15u );
+        BOOST_TEST_EQ( ( endian_validate<std::uint8_t, 1, order::big>( dst, src, 6, bit1() ) ), 1u );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,233 @@
+// Copyright 2026 Julien Blanc
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/endian/varint.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+
+static std::uint64_t const values[] =
+{
+    0, 1, 127, 128, 255, 300, 16383, 16384, 0xFFFFFFFFu, 0x100000000ull,
+    0x00FFFFFFFFFFFFFFull, 0x0100000000000000ull, 0x7FFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull
+};
+
+static std::size_t const value_count = sizeof( values ) / sizeof( values[ 0 ] );
+
+template<boost::endian::order Order> void test_streamvbyte()
+{
+    using namespace boost::endian;
+
+    for( std::size_t n = 0; n <= 41; ++n )
+    {
+        std::uint32_t in[ 41 ];
+
+        std::uint32_t x = 1;
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            x = x * 1664525u + 1013904223u;
+            in[ i ] = x >> ( ( i % 4 ) * 8 );
+        }
+
+        unsigned char buffer[ 41 * 5 ];
+
+        std::size_t size = streamvbyte_encode<Order>( buffer, in, n );
+
+        BOOST_TEST( size <= streamvbyte_max_size( n ) );
+
+        std::uint32_t out[ 41 ];
+
+        BOOST_TEST_EQ( streamvbyte_decode<Order>( out, buffer, size, n ), size );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            BOOST_TEST_EQ( out[ i ], in[ i ] );
+        }
+
+        if( n > 0 )
+        {
+            BOOST_TEST_EQ( streamvbyte_decode<Order>( out, buffer, size - 1, n ), 0u );
+        }
+    }
+}
+
+int main()
+{
+    using namespace boost::endian;
+
+    // zigzag
+
+    BOOST_TEST_EQ( zigzag_encode( std::int32_t( 0 ) ), 0u );
+    BOOST_TEST_EQ( zigzag_encode( std::int32_t( -1 ) ), 1u );
+    BOOST_TEST_EQ( zigzag_encode( std::int32_t( 1 ) ), 2u );
+    BOOST_TEST_EQ( zigzag_encode( std::int32_t( -2 ) ), 3u );
+    BOOST_TEST_EQ( zigzag_encode( std::int32_t( 0x7FFFFFFF ) ), 0xFFFFFFFEu );
+    BOOST_TEST_EQ( zigzag_encode( std::int32_t( -0x7FFFFFFF - 1 ) ), 0xFFFFFFFFu );
+
+    BOOST_TEST_EQ( zigzag_encode( std::int64_t( -1 ) ), 1u );
+    BOOST_TEST_EQ( zigzag_encode( std::int64_t( -0x7FFFFFFFFFFFFFFFll - 1 ) ), 0xFFFFFFFFFFFFFFFFull );
+
+    for( std::int32_t i = -1000; i <= 1000; ++i )
+    {
+        BOOST_TEST_EQ( zigzag_decode( zigzag_encode( i ) ), i );
+        std::int64_t const j = static_cast<std::int64_t>( i ) * 0x100000001ll;
+        BOOST_TEST_EQ( zigzag_decode( zigzag_encode( j ) ), j );
+    }
+
+    // LEB128
+
+    {
+        unsigned char buffer[ 16 ];
+
+        BOOST_TEST_EQ( store_leb128_u32( buffer, 300 ), 2u );
+        BOOST_TEST_EQ( buffer[ 0 ], 0xAC );
+        BOOST_TEST_EQ( buffer[ 1 ], 0x02 );
+
+        for( std::size_t i = 0; i < value_count; ++i )
+        {
+            std::uint64_t const v = values[ i ];
+
+            // with and without padding, to use both the wide and the byte loop
+
+            for( std::size_t pad = 0; pad <= 8; pad += 8 )
+            {
+                std::size_t n = store_leb128_u64( buffer, v );
+
+                std::uint64_t w = 0;
+
+                BOOST_TEST_EQ( load_leb128_u64( buffer, buffer + n + pad, w ), n );
+                BOOST_TEST_EQ( w, v );
+
+                BOOST_TEST_EQ( load_leb128_u64( buffer, buffer + n - 1, w ), 0u );
+
+                std::uint32_t w32 = 0;
+
+                if( v <= 0xFFFFFFFFu )
+                {
+                    BOOST_TEST_EQ( load_leb128_u32( buffer, buffer + n + pad, w32 ), n );
+                    BOOST_TEST_EQ( w32, v );
+                }
+                else
+                {
+                    BOOST_TEST_EQ( load_leb128_u32( buffer, buffer + n + pad, w32 ), 0u );
+                }
+            }
+        }
+
+        // overlong
+
+        unsigned char const bad[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0, 0 };
+
+        std::uint64_t w = 0;
+        BOOST_TEST_EQ( load_leb128_u64( bad, bad + sizeof( bad ), w ), 0u );
+
+        // redundant encodings of 0 and 1, with and without 8 readable bytes
+
+        unsigned char const zero[] = { 0x80, 0x00, 0, 0, 0, 0, 0, 0 };
+        unsigned char const one[] = { 0x81, 0x80, 0x80, 0x00, 0, 0, 0, 0 };
+
+        BOOST_TEST_EQ( load_leb128_u64( zero, zero + sizeof( zero ), w ), 0u );
+        BOOST_TEST_EQ( load_leb128_u64( zero, zero + 2, w ), 0u );
+        BOOST_TEST_EQ( load_leb128_u64( one, one + sizeof( one ), w ), 0u );
+        BOOST_TEST_EQ( load_leb128_u64( one, one + 4, w ), 0u );
+
+        // a single zero byte is the encoding of 0
+
+        BOOST_TEST_EQ( load_leb128_u64( zero + 1, zero + sizeof( zero ), w ), 1u );
+        BOOST_TEST_EQ( w, 0u );
+
+        // bits past 32 or 64 in the last byte
+
+        unsigned char const big32[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0, 0, 0 };
+        unsigned char const big64[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03 };
+
+        std::uint32_t w32 = 0;
+
+        BOOST_TEST_EQ( load_leb128_u32( big32, big32 + sizeof( big32 ), w32 ), 0u );
+        BOOST_TEST_EQ( load_leb128_u32( big32, big32 + 5, w32 ), 0u );
+        BOOST_TEST_EQ( load_leb128_u64( big64, big64 + sizeof( big64 ), w ), 0u );
+    }
+
+    {
+        unsigned char buffer[ value_count * 10 ];
+        unsigned char * p = buffer;
+
+        for( std::size_t i = 0; i < value_count; ++i )
+        {
+            p += store_leb128_u64( p, values[ i ] );
+        }
+
+        std::uint64_t out[ value_count ];
+
+        BOOST_TEST_EQ( load_leb128_n( out, value_count, buffer, p ), static_cast<std::size_t>( p - buffer ) );
+
+        for( std::size_t i = 0; i < value_count; ++i )
+        {
+            BOOST_TEST_EQ( out[ i ], values[ i ] );
+        }
+
+        BOOST_TEST_EQ( load_leb128_n( out, value_count, buffer, p - 1 ), 0u );
+    }
+
+    // prefix varint
+
+    {
+        unsigned char buffer[ 24 ];
+
+        BOOST_TEST_EQ( store_prefix_varint_u64( buffer, 0 ), 1u );
+        BOOST_TEST_EQ( buffer[ 0 ], 0x01 );
+
+        BOOST_TEST_EQ( store_prefix_varint_u64( buffer, 127 ), 1u );
+        BOOST_TEST_EQ( buffer[ 0 ], 0xFF );
+
+        BOOST_TEST_EQ( store_prefix_varint_u64( buffer, 128 ), 2u );
+        BOOST_TEST_EQ( buffer[ 0 ], 0x02 );
+        BOOST_TEST_EQ( buffer[ 1 ], 0x02 );
+
+        for( std::size_t i = 0; i < value_count; ++i )
+        {
+            std::uint64_t const v = values[ i ];
+
+            for( std::size_t pad = 0; pad <= 8; pad += 8 )
+            {
+                std::size_t n = store_prefix_varint_u64( buffer, v );
+
+                std::uint64_t w = 0;
+
+                BOOST_TEST_EQ( load_prefix_varint_u64( buffer, buffer + n + pad, w ), n );
+                BOOST_TEST_EQ( w, v );
+
+                BOOST_TEST_EQ( load_prefix_varint_u64( buffer, buffer + n - 1, w ), 0u );
+            }
+        }
+    }
+
+    // Stream VByte
+
+    {
+        std::uint32_t const in[] = { 1, 0x0200, 0x030000, 0x04000000, 5 };
+
+        unsigned char buffer[ 32 ];
+
+        BOOST_TEST_EQ( streamvbyte_encode<order::little>( buffer, in, 5 ), 2u + 11u );
+
+        BOOST_TEST_EQ( buffer[ 0 ], 0xE4 );
+        BOOST_TEST_EQ( buffer[ 1 ], 0x00 );
+        BOOST_TEST_EQ( buffer[ 2 ], 0x01 );
+        BOOST_TEST_EQ( buffer[ 3 ], 0x00 );
+        BOOST_TEST_EQ( buffer[ 4 ], 0x02 );
+
+        streamvbyte_encode<order::big>( buffer, in, 5 );
+
+        BOOST_TEST_EQ( buffer[ 2 ], 0x01 );
+        BOOST_TEST_EQ( buffer[ 3 ], 0x02 );
+        BOOST_TEST_EQ( buffer[ 4 ], 0x00 );
+    }
+
+    test_streamvbyte<order::little>();
+    test_streamvbyte<order::big>();
+
+    return boost::report_errors();
+}